@@ -14,6 +14,24 @@
 #include "math.h"
 #include "types.h"
 
+/*** DPS310 macros ***/
+
+#define DPS310_CALIBRATION_BLOB_SIZE_BYTES  23
+
+#if (defined DPS310_DRIVER_SAMPLE_BUFFER_SIZE) && ((DPS310_DRIVER_SAMPLE_BUFFER_SIZE < 2) || ((DPS310_DRIVER_SAMPLE_BUFFER_SIZE & (DPS310_DRIVER_SAMPLE_BUFFER_SIZE - 1)) != 0))
+#error "DPS310 driver: DPS310_DRIVER_SAMPLE_BUFFER_SIZE must be a power of 2"
+#endif
+
+#if (defined DPS310_DRIVER_FILTER) && !(defined DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX)
+#define DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX    5
+#endif
+#if (defined DPS310_DRIVER_FILTER) && ((DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX < 3) || (DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX > 255) || ((DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX & 0x01) == 0))
+#error "DPS310 driver: DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX must be an odd number from 3 (default window) to 255"
+#endif
+
+// Filter gains unit (Q16).
+#define DPS310_FILTER_GAIN_ONE                  65536
+
 /*** DPS310 structures ***/
 
 /*!******************************************************************
@@ -28,6 +46,21 @@ typedef enum {
     DPS310_ERROR_SENSOR_TIMEOUT,
     DPS310_ERROR_TEMPERATURE_TIMEOUT,
     DPS310_ERROR_PRESSURE_TIMEOUT,
+    DPS310_ERROR_MEASUREMENT_RATE,
+    DPS310_ERROR_OVERSAMPLING,
+    DPS310_ERROR_UNIT,
+    DPS310_ERROR_STREAMING_RUNNING,
+    DPS310_ERROR_STREAMING_STOPPED,
+    DPS310_ERROR_MEASUREMENT_RUNNING,
+    DPS310_ERROR_MEASUREMENT_STATE,
+    DPS310_ERROR_INTERRUPT,
+    DPS310_ERROR_PRESSURE_RANGE,
+    DPS310_ERROR_MEDIAN_SIZE,
+    DPS310_ERROR_FILTER_GAIN,
+    DPS310_ERROR_PRODUCT_ID,
+    DPS310_ERROR_LOG_BUFFER_SIZE,
+    DPS310_ERROR_LOG_HEADER,
+    DPS310_ERROR_LOG_RECORD,
     // Low level drivers errors.
     DPS310_ERROR_BASE_I2C = 0x0100,
     DPS310_ERROR_BASE_DELAY = (DPS310_ERROR_BASE_I2C + DPS310_DRIVER_I2C_ERROR_BASE_LAST),
@@ -38,6 +71,318 @@ typedef enum {
 
 #ifndef DPS310_DRIVER_DISABLE
 
+/*!******************************************************************
+ * \enum DPS310_measurement_rate_t
+ * \brief DPS310 background measurement rates (measurements per second).
+ *******************************************************************/
+typedef enum {
+    DPS310_MEASUREMENT_RATE_1HZ = 0,
+    DPS310_MEASUREMENT_RATE_2HZ,
+    DPS310_MEASUREMENT_RATE_4HZ,
+    DPS310_MEASUREMENT_RATE_8HZ,
+    DPS310_MEASUREMENT_RATE_16HZ,
+    DPS310_MEASUREMENT_RATE_32HZ,
+    DPS310_MEASUREMENT_RATE_64HZ,
+    DPS310_MEASUREMENT_RATE_128HZ,
+    DPS310_MEASUREMENT_RATE_LAST
+} DPS310_measurement_rate_t;
+
+/*!******************************************************************
+ * \enum DPS310_oversampling_t
+ * \brief DPS310 oversampling rates (number of samples per measurement).
+ *******************************************************************/
+typedef enum {
+    DPS310_OVERSAMPLING_1 = 0,
+    DPS310_OVERSAMPLING_2,
+    DPS310_OVERSAMPLING_4,
+    DPS310_OVERSAMPLING_8,
+    DPS310_OVERSAMPLING_16,
+    DPS310_OVERSAMPLING_32,
+    DPS310_OVERSAMPLING_64,
+    DPS310_OVERSAMPLING_128,
+    DPS310_OVERSAMPLING_LAST
+} DPS310_oversampling_t;
+
+/*!******************************************************************
+ * \enum DPS310_pressure_unit_t
+ * \brief DPS310 pressure output units.
+ *******************************************************************/
+typedef enum {
+    DPS310_PRESSURE_UNIT_PA = 0,
+    DPS310_PRESSURE_UNIT_PA_Q6, // 1/64 Pa.
+    DPS310_PRESSURE_UNIT_LAST
+} DPS310_pressure_unit_t;
+
+/*!******************************************************************
+ * \enum DPS310_temperature_unit_t
+ * \brief DPS310 temperature output units.
+ *******************************************************************/
+typedef enum {
+    DPS310_TEMPERATURE_UNIT_DEGREES = 0,
+    DPS310_TEMPERATURE_UNIT_CENTI_DEGREES, // 1/100 Celsius degree.
+    DPS310_TEMPERATURE_UNIT_LAST
+} DPS310_temperature_unit_t;
+
+/*!******************************************************************
+ * \struct DPS310_configuration_t
+ * \brief DPS310 measurements configuration.
+ *******************************************************************/
+typedef struct {
+    DPS310_measurement_rate_t pressure_rate;
+    DPS310_oversampling_t pressure_oversampling;
+    DPS310_measurement_rate_t temperature_rate;
+    DPS310_oversampling_t temperature_oversampling;
+    DPS310_pressure_unit_t pressure_unit;
+    DPS310_temperature_unit_t temperature_unit;
+    uint32_t temperature_period; // Number of single measurements sharing the same temperature (0 or 1 to measure temperature every time).
+} DPS310_configuration_t;
+
+/*!******************************************************************
+ * \struct DPS310_coefficients_t
+ * \brief DPS310 decoded calibration coefficients.
+ *******************************************************************/
+typedef struct {
+    int32_t c0;
+    int32_t c1;
+    int32_t c00;
+    int32_t c10;
+    int32_t c01;
+    int32_t c11;
+    int32_t c20;
+    int32_t c21;
+    int32_t c30;
+} DPS310_coefficients_t;
+
+/*!******************************************************************
+ * \enum DPS310_interrupt_t
+ * \brief DPS310 interrupt sources (can be combined).
+ *******************************************************************/
+typedef enum {
+    DPS310_INTERRUPT_NONE = 0x00,
+    DPS310_INTERRUPT_PRESSURE = 0x01,
+    DPS310_INTERRUPT_TEMPERATURE = 0x02,
+    DPS310_INTERRUPT_FIFO_FULL = 0x04,
+    DPS310_INTERRUPT_ALL = 0x07
+} DPS310_interrupt_t;
+
+/*!******************************************************************
+ * \brief DPS310 interrupt notification callback (called in interrupt context).
+ *******************************************************************/
+typedef void (*DPS310_interrupt_cb_t)(void);
+
+/*!******************************************************************
+ * \enum DPS310_fifo_sample_type_t
+ * \brief DPS310 FIFO sample types.
+ *******************************************************************/
+typedef enum {
+    DPS310_FIFO_SAMPLE_TYPE_TEMPERATURE = 0,
+    DPS310_FIFO_SAMPLE_TYPE_PRESSURE,
+    DPS310_FIFO_SAMPLE_TYPE_LAST
+} DPS310_fifo_sample_type_t;
+
+/*!******************************************************************
+ * \struct DPS310_fifo_sample_t
+ * \brief DPS310 FIFO sample.
+ *******************************************************************/
+typedef struct {
+    DPS310_fifo_sample_type_t type;
+    int32_t value;
+} DPS310_fifo_sample_t;
+
+#ifdef DPS310_DRIVER_FILTER
+/*!******************************************************************
+ * \enum DPS310_filter_stage_t
+ * \brief DPS310 pressure filter stages (applied in this order).
+ *******************************************************************/
+typedef enum {
+    DPS310_FILTER_STAGE_NONE = 0x00,
+    DPS310_FILTER_STAGE_MEDIAN = 0x01,
+    DPS310_FILTER_STAGE_IIR = 0x02,
+    DPS310_FILTER_STAGE_KALMAN = 0x04,
+    DPS310_FILTER_STAGE_ALL = 0x07
+} DPS310_filter_stage_t;
+
+/*!******************************************************************
+ * \struct DPS310_filter_configuration_t
+ * \brief DPS310 pressure filter configuration (the Kalman variances share an arbitrary scale independent of the pressure unit: the covariance
+ * starts at the measurement variance, so only their ratio matters, default 3 / 256 for a steady state gain of 0.103, larger values give a finer ratio).
+ *******************************************************************/
+typedef struct {
+    uint8_t stages_mask;
+    uint8_t median_size; // Odd number of samples, up to DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX.
+    uint32_t iir_alpha; // Q16 weight of the new sample.
+    uint32_t kalman_process_variance; // Q, same scale as kalman_measurement_variance.
+    uint32_t kalman_measurement_variance; // R.
+} DPS310_filter_configuration_t;
+#endif
+
+#ifdef DPS310_DRIVER_STATISTICS
+/*!******************************************************************
+ * \enum DPS310_statistics_call_t
+ * \brief DPS310 public functions with latency statistics (DPS310_get_pressure_temperature_multiple() is recorded in all handles of the group).
+ *******************************************************************/
+typedef enum {
+    DPS310_STATISTICS_CALL_INIT_SENSOR = 0,
+    DPS310_STATISTICS_CALL_EXPORT_CALIBRATION,
+    DPS310_STATISTICS_CALL_IMPORT_CALIBRATION,
+    DPS310_STATISTICS_CALL_GET_PRESSURE_TEMPERATURE,
+    DPS310_STATISTICS_CALL_GET_PRESSURE_TEMPERATURE_MULTIPLE,
+    DPS310_STATISTICS_CALL_START_MEASUREMENT,
+    DPS310_STATISTICS_CALL_PROCESS,
+    DPS310_STATISTICS_CALL_START_STREAMING,
+    DPS310_STATISTICS_CALL_STOP_STREAMING,
+    DPS310_STATISTICS_CALL_READ_FIFO,
+    DPS310_STATISTICS_CALL_ACQUIRE_FIFO,
+    DPS310_STATISTICS_CALL_LAST
+} DPS310_statistics_call_t;
+
+/*!******************************************************************
+ * \struct DPS310_call_statistics_t
+ * \brief DPS310 latency of a public function (measured with DPS310_HW_get_timestamp_us()).
+ *******************************************************************/
+typedef struct {
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint32_t average_us;
+    uint64_t total_us;
+} DPS310_call_statistics_t;
+
+/*!******************************************************************
+ * \struct DPS310_statistics_t
+ * \brief DPS310 driver activity counters.
+ *******************************************************************/
+typedef struct {
+    uint32_t i2c_transaction_count; // Calls to the HW interface transfer functions.
+    uint32_t i2c_byte_count;
+    uint32_t flag_poll_count;
+    uint32_t delay_ms; // Requested DPS310_HW_delay_milliseconds() durations (DPS310_HW_wait_interrupt() sleeps are only measured by DPS310_get_wait_time()).
+    uint32_t coefficients_timeout_count;
+    uint32_t sensor_timeout_count;
+    uint32_t temperature_timeout_count;
+    uint32_t pressure_timeout_count;
+    DPS310_call_statistics_t calls[DPS310_STATISTICS_CALL_LAST];
+} DPS310_statistics_t;
+#endif
+
+/*!******************************************************************
+ * \struct DPS310_sample_t
+ * \brief DPS310 dated pressure sample with the temperature used to compensate it.
+ *******************************************************************/
+typedef struct {
+    uint32_t timestamp_us;
+    int32_t pressure;
+    int32_t temperature;
+} DPS310_sample_t;
+
+/*!******************************************************************
+ * \brief DPS310 non-blocking measurement completion callback.
+ *******************************************************************/
+typedef void (*DPS310_measurement_completion_cb_t)(void);
+
+/*!******************************************************************
+ * \struct DPS310_measurement_t
+ * \brief DPS310 dated measurement of a sensor among several ones.
+ *******************************************************************/
+typedef struct {
+    DPS310_status_t status;
+    int32_t pressure;
+    int32_t temperature;
+    uint32_t timestamp_us; // Date of the end of conversion (given by DPS310_HW_get_timestamp_us()).
+} DPS310_measurement_t;
+
+/*!******************************************************************
+ * \enum DPS310_measurement_state_t
+ * \brief DPS310 non-blocking measurement states.
+ *******************************************************************/
+typedef enum {
+    DPS310_MEASUREMENT_STATE_IDLE = 0,
+    DPS310_MEASUREMENT_STATE_COEFFICIENTS_WAIT,
+    DPS310_MEASUREMENT_STATE_COEFFICIENTS_READ,
+    DPS310_MEASUREMENT_STATE_SENSOR_WAIT,
+    DPS310_MEASUREMENT_STATE_SHIFT_CONFIGURATION,
+    DPS310_MEASUREMENT_STATE_TEMPERATURE_CONFIGURATION,
+    DPS310_MEASUREMENT_STATE_TEMPERATURE_TRIGGER,
+    DPS310_MEASUREMENT_STATE_TEMPERATURE_WAIT,
+    DPS310_MEASUREMENT_STATE_PRESSURE_CONFIGURATION,
+    DPS310_MEASUREMENT_STATE_PRESSURE_TRIGGER,
+    DPS310_MEASUREMENT_STATE_PRESSURE_WAIT,
+    DPS310_MEASUREMENT_STATE_RESULTS_READ,
+    DPS310_MEASUREMENT_STATE_DONE,
+    DPS310_MEASUREMENT_STATE_LAST
+} DPS310_measurement_state_t;
+
+/*!******************************************************************
+ * \struct DPS310_handle_t
+ * \brief DPS310 sensor instance (fields are private and must be initialized with DPS310_init_handle()).
+ *******************************************************************/
+typedef struct {
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    // Bus.
+    uint8_t i2c_instance;
+    uint8_t i2c_address;
+    // Configuration.
+    DPS310_configuration_t configuration;
+    uint8_t prs_cfg;
+    uint8_t tmp_cfg;
+#endif
+    uint8_t cfg_reg;
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    // Interrupts.
+    uint8_t interrupt_mask;
+    volatile uint8_t interrupt_flag;
+    uint8_t interrupt_status;
+    DPS310_interrupt_cb_t interrupt_callback;
+#endif
+    // Sensor registers cache.
+    uint8_t sensor_ready_flag;
+    uint8_t shadow_registers[4]; // PRS_CFG to CFG_REG (MEAS_CFG is never cached).
+    uint8_t shadow_registers_valid_mask;
+    // Measurements.
+    int32_t tmp_raw;
+    int32_t prs_raw;
+    uint32_t wait_time_us;
+    uint8_t tmp_raw_valid_flag;
+    uint8_t temperature_measurement_flag;
+    uint32_t temperature_age;
+    // Calibration coefficients.
+    uint8_t coef_ready_flag;
+    uint8_t tmp_coef_srce;
+    DPS310_coefficients_t coefficients;
+    // Streaming mode.
+    uint8_t streaming_flag;
+    // Non-blocking measurement.
+    DPS310_measurement_state_t measurement_state;
+    uint32_t measurement_poll_count;
+    uint32_t measurement_wait_start_us;
+    DPS310_measurement_completion_cb_t measurement_completion_callback;
+#ifdef DPS310_DRIVER_SAMPLE_BUFFER_SIZE
+    // Samples buffer (written by the acquisition side, read by the application side).
+    DPS310_sample_t sample_buffer[DPS310_DRIVER_SAMPLE_BUFFER_SIZE];
+    volatile uint32_t sample_buffer_write_index;
+    volatile uint32_t sample_buffer_read_index;
+    volatile uint32_t sample_buffer_overrun_count;
+    volatile uint32_t fifo_overrun_count;
+#endif
+#ifdef DPS310_DRIVER_FILTER
+    // Pressure filter.
+    DPS310_filter_configuration_t filter_configuration;
+    int32_t filter_median_history[DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX];
+    uint8_t filter_median_count;
+    uint8_t filter_median_index;
+    uint8_t filter_initialized_flag;
+    int64_t filter_iir_state;
+    int64_t filter_kalman_state;
+    uint32_t filter_kalman_covariance;
+    uint32_t filter_kalman_gain;
+    uint8_t filter_kalman_steady_flag;
+#endif
+#ifdef DPS310_DRIVER_STATISTICS
+    // Statistics.
+    DPS310_statistics_t statistics;
+#endif
+} DPS310_handle_t;
+
 /*** DPS310 functions ***/
 
 /*!******************************************************************
@@ -59,14 +404,334 @@ DPS310_status_t DPS310_init(void);
 DPS310_status_t DPS310_de_init(void);
 
 /*!******************************************************************
- * \fn DPS310_status_t DPS310_get_pressure_temperature(uint8_t i2c_address, int32_t* pressure_pa, int32_t* temperature_degrees)
+ * \fn DPS310_status_t DPS310_init_handle(DPS310_handle_t* handle, uint8_t i2c_instance, uint8_t i2c_address)
+ * \brief Init a DPS310 sensor instance.
+ * \param[in]   handle: Pointer to the caller-owned sensor instance.
+ * \param[in]   i2c_instance: I2C bus of the sensor (forwarded to the hardware interface), ignored with DPS310_DRIVER_STATIC_CONFIGURATION (DPS310_DRIVER_STATIC_I2C_INSTANCE is used).
+ * \param[in]   i2c_address: I2C address of the sensor, ignored with DPS310_DRIVER_STATIC_CONFIGURATION (DPS310_DRIVER_STATIC_I2C_ADDRESS is used).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_init_handle(DPS310_handle_t* handle, uint8_t i2c_instance, uint8_t i2c_address);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_init_sensor(DPS310_handle_t* handle, uint8_t i2c_instance, uint8_t i2c_address, DPS310_configuration_t* configuration)
+ * \brief Init a DPS310 sensor instance and probe the sensor, so that the first measurement is not slower than the next ones.
+ * \param[in]   handle: Pointer to the caller-owned sensor instance.
+ * \param[in]   i2c_instance: I2C bus of the sensor (forwarded to the hardware interface), ignored with DPS310_DRIVER_STATIC_CONFIGURATION (DPS310_DRIVER_STATIC_I2C_INSTANCE is used).
+ * \param[in]   i2c_address: I2C address of the sensor, ignored with DPS310_DRIVER_STATIC_CONFIGURATION (DPS310_DRIVER_STATIC_I2C_ADDRESS is used).
+ * \param[in]   configuration: Pointer to the initial configuration (default configuration if NULL), ignored with DPS310_DRIVER_STATIC_CONFIGURATION (the DPS310_DRIVER_STATIC_* flags are used).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_init_sensor(DPS310_handle_t* handle, uint8_t i2c_instance, uint8_t i2c_address, DPS310_configuration_t* configuration);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_invalidate_cache(DPS310_handle_t* handle)
+ * \brief Invalidate the driver copy of the sensor registers (to be called after a sensor reset or a bus fault).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_invalidate_cache(DPS310_handle_t* handle);
+
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_set_configuration(DPS310_handle_t* handle, DPS310_configuration_t* configuration)
+ * \brief Set measurements rate, oversampling and output units (default is 1Hz with 2 times pressure and single temperature oversampling, Pa and Celsius degrees).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   configuration: Pointer to the measurements configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_set_configuration(DPS310_handle_t* handle, DPS310_configuration_t* configuration);
+#endif
+
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_enable_interrupt(DPS310_handle_t* handle, uint8_t interrupt_mask, DPS310_interrupt_cb_t interrupt_callback)
+ * \brief Enable the interrupt pin of the sensor: readiness is then given by the interrupt instead of polling the sensor registers (blocking functions sleep in DPS310_HW_wait_interrupt(), or during the conversion time if it is not implemented).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   interrupt_mask: Combination of DPS310_interrupt_t sources (without pressure or temperature source, the corresponding flag is still polled).
+ * \param[in]   interrupt_callback: Function called in interrupt context when the sensor interrupt occurs (optional, can be NULL).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_enable_interrupt(DPS310_handle_t* handle, uint8_t interrupt_mask, DPS310_interrupt_cb_t interrupt_callback);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_disable_interrupt(DPS310_handle_t* handle)
+ * \brief Disable the interrupt pin of the sensor and go back to registers polling.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_disable_interrupt(DPS310_handle_t* handle);
+#endif
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_export_calibration(DPS310_handle_t* handle, uint8_t* calibration_blob)
+ * \brief Export the calibration coefficients and temperature source of the sensor (read from the sensor if needed) in a versioned and CRC-protected blob (with the product ID, the unit itself is not identified).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  calibration_blob: Byte array of DPS310_CALIBRATION_BLOB_SIZE_BYTES bytes that will contain the blob.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_export_calibration(DPS310_handle_t* handle, uint8_t* calibration_blob);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_import_calibration(DPS310_handle_t* handle, uint8_t* calibration_blob, uint8_t* calibration_valid_flag)
+ * \brief Import calibration coefficients previously exported with DPS310_export_calibration(), to skip their reading on the first measurement. The blob is matched by product ID only (read from the sensor, it is available before the coefficients memory is loaded): nothing identifies the unit, so the application must import the blob exported from the same one.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   calibration_blob: Byte array of DPS310_CALIBRATION_BLOB_SIZE_BYTES bytes containing the blob.
+ * \param[out]  calibration_valid_flag: Pointer to byte that will contain 1 if the blob has been imported, 0 if it is invalid for this sensor (coefficients will then be read from the sensor).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_import_calibration(DPS310_handle_t* handle, uint8_t* calibration_blob, uint8_t* calibration_valid_flag);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_pressure_temperature(DPS310_handle_t* handle, int32_t* pressure, int32_t* temperature)
  * \brief Perform pressure and temperature measurements.
- * \param[in]   i2c_address: I2C address of the sensor.
- * \param[out]  pressure_pa: Pointer to integer that will contain the atmospheric pressure in Pa.
- * \param[out]  temperature_degrees: Pointer to integer that will contain the temperature in Celsius degrees.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  pressure: Pointer to integer that will contain the atmospheric pressure in the configured unit.
+ * \param[out]  temperature: Pointer to integer that will contain the temperature in the configured unit.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_get_pressure_temperature(DPS310_handle_t* handle, int32_t* pressure, int32_t* temperature);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_wait_time(DPS310_handle_t* handle, uint32_t* wait_time_us)
+ * \brief Get the time spent waiting for the sensor during the last blocking measurement or streaming start.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  wait_time_us: Pointer to integer that will contain the wait time in us, measured with DPS310_HW_get_timestamp_us() (0 if it is not implemented).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_get_wait_time(DPS310_handle_t* handle, uint32_t* wait_time_us);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_temperature_age(DPS310_handle_t* handle, uint32_t* temperature_age)
+ * \brief Get the age of the temperature used to compensate the last single measurement.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  temperature_age: Pointer to integer that will contain the number of previous measurements which already used the same temperature (0 if it was measured along with the pressure).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_get_temperature_age(DPS310_handle_t* handle, uint32_t* temperature_age);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_raw_results(DPS310_handle_t* handle, int32_t* prs_raw, int32_t* tmp_raw)
+ * \brief Get the raw results of the last single measurement (to be stored and compensated later with DPS310_compensate()).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  prs_raw: Pointer to integer that will contain the raw pressure result.
+ * \param[out]  tmp_raw: Pointer to integer that will contain the raw temperature used to compensate this pressure.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_get_raw_results(DPS310_handle_t* handle, int32_t* prs_raw, int32_t* tmp_raw);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_coefficients(DPS310_handle_t* handle, DPS310_coefficients_t* coefficients)
+ * \brief Get the decoded calibration coefficients of the sensor (read from the sensor if needed).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  coefficients: Pointer to the structure that will contain the coefficients.
  * \retval      Function execution status.
  *******************************************************************/
-DPS310_status_t DPS310_get_pressure_temperature(uint8_t i2c_address, int32_t* pressure_pa, int32_t* temperature_degrees);
+DPS310_status_t DPS310_get_coefficients(DPS310_handle_t* handle, DPS310_coefficients_t* coefficients);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_start_measurement(DPS310_handle_t* handle, DPS310_measurement_completion_cb_t completion_callback)
+ * \brief Start non-blocking pressure and temperature measurements.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   completion_callback: Function called by DPS310_process() when results are available (optional, can be NULL).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_start_measurement(DPS310_handle_t* handle, DPS310_measurement_completion_cb_t completion_callback);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_process(DPS310_handle_t* handle)
+ * \brief Advance the non-blocking measurement by a single I2C step, without any delay.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status (the measurement is aborted on error, a flag still cleared after the blocking functions timeout gives a timeout error, also in interrupt mode,
+ *              measured with DPS310_HW_get_timestamp_us() from the first poll of the flag, or after 1000 polls if the timestamp does not advance).
+ *******************************************************************/
+DPS310_status_t DPS310_process(DPS310_handle_t* handle);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_read_measurement(DPS310_handle_t* handle, int32_t* pressure, int32_t* temperature, uint8_t* measurement_done_flag)
+ * \brief Read the result of the non-blocking measurement.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  pressure: Pointer to integer that will contain the atmospheric pressure in the configured unit.
+ * \param[out]  temperature: Pointer to integer that will contain the temperature in the configured unit.
+ * \param[out]  measurement_done_flag: Pointer to flag set when the measurement is complete and results are valid.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_read_measurement(DPS310_handle_t* handle, int32_t* pressure, int32_t* temperature, uint8_t* measurement_done_flag);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_pressure_temperature_multiple(DPS310_handle_t* handles, uint8_t number_of_sensors, DPS310_measurement_t* measurements)
+ * \brief Perform pressure and temperature measurements on several sensors with overlapping conversions.
+ * \param[in]   handles: Array of sensor instances.
+ * \param[in]   number_of_sensors: Number of sensors in the array.
+ * \param[out]  measurements: Array that will contain the status, results and date of each sensor measurement.
+ * \retval      Function execution status (the status of each sensor is given in the measurements array).
+ *******************************************************************/
+DPS310_status_t DPS310_get_pressure_temperature_multiple(DPS310_handle_t* handles, uint8_t number_of_sensors, DPS310_measurement_t* measurements);
+
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_start_streaming(DPS310_handle_t* handle)
+ * \brief Start continuous pressure and temperature measurements with FIFO enabled, using the configured rates and oversampling.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_start_streaming(DPS310_handle_t* handle);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_stop_streaming(DPS310_handle_t* handle)
+ * \brief Stop continuous measurements, disable and flush FIFO.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_stop_streaming(DPS310_handle_t* handle);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_read_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag)
+ * \brief Drain the sensor FIFO (up to 32 samples).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   samples_size: Maximum number of samples to read.
+ * \param[out]  samples: Array that will contain the compensated samples (pressure or temperature in the configured units).
+ * \param[out]  number_of_samples: Pointer to the number of samples read.
+ * \param[out]  fifo_full_flag: Pointer to flag set if the FIFO was full before draining (new measurements have been lost).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_read_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_read_fifo_raw(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag)
+ * \brief Drain the sensor FIFO (up to 32 samples) without compensation.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   samples_size: Maximum number of samples to read.
+ * \param[out]  samples: Array that will contain the raw samples (24-bits signed values, to be compensated later with DPS310_compensate()).
+ * \param[out]  number_of_samples: Pointer to the number of samples read.
+ * \param[out]  fifo_full_flag: Pointer to flag set if the FIFO was full before draining (new measurements have been lost).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_read_fifo_raw(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag);
+#endif
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_compensate(DPS310_coefficients_t* coefficients, DPS310_configuration_t* configuration, int32_t* prs_raw, int32_t* tmp_raw, int32_t* pressure, int32_t* temperature, uint32_t number_of_samples)
+ * \brief Compensate an array of raw samples (reentrant, does not access any sensor or driver state).
+ * \param[in]   coefficients: Pointer to the calibration coefficients of the sensor which produced the samples.
+ * \param[in]   configuration: Pointer to the configuration used during acquisition (oversampling and output units).
+ * \param[in]   prs_raw: Array of raw pressure samples.
+ * \param[in]   tmp_raw: Array of raw temperature samples associated to each pressure sample.
+ * \param[in]   number_of_samples: Number of samples to compensate.
+ * \param[out]  pressure: Array that will contain the compensated pressures.
+ * \param[out]  temperature: Array that will contain the compensated temperatures (optional, can be NULL).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_compensate(DPS310_coefficients_t* coefficients, DPS310_configuration_t* configuration, int32_t* prs_raw, int32_t* tmp_raw, int32_t* pressure, int32_t* temperature, uint32_t number_of_samples);
+
+#ifdef DPS310_DRIVER_SAMPLE_BUFFER_SIZE
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_acquire_fifo(DPS310_handle_t* handle, uint8_t* number_of_samples)
+ * \brief Drain the sensor FIFO into the samples buffer (acquisition side, called from a task or the main loop since it uses the I2C bus: the interrupt callback only signals the FIFO full interrupt).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  number_of_samples: Pointer to integer that will contain the number of pressure samples pushed in the buffer.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_acquire_fifo(DPS310_handle_t* handle, uint8_t* number_of_samples);
+#endif
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_pop_samples(DPS310_handle_t* handle, DPS310_sample_t* samples, uint32_t samples_size, uint32_t* number_of_samples)
+ * \brief Pop samples from the buffer (application side, no locking required when the buffer is filled by a single task).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   samples_size: Maximum number of samples to pop.
+ * \param[out]  samples: Array that will contain the oldest samples of the buffer.
+ * \param[out]  number_of_samples: Pointer to integer that will contain the number of popped samples.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_pop_samples(DPS310_handle_t* handle, DPS310_sample_t* samples, uint32_t samples_size, uint32_t* number_of_samples);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_overrun_counts(DPS310_handle_t* handle, uint32_t* sample_buffer_overrun_count, uint32_t* fifo_overrun_count)
+ * \brief Get the number of samples lost since the handle initialization.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  sample_buffer_overrun_count: Pointer to integer that will contain the number of samples dropped because the buffer was full.
+ * \param[out]  fifo_overrun_count: Pointer to integer that will contain the number of sensor FIFO drains which found the FIFO full (samples may have been lost).
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_get_overrun_counts(DPS310_handle_t* handle, uint32_t* sample_buffer_overrun_count, uint32_t* fifo_overrun_count);
+#endif
+
+#ifdef DPS310_DRIVER_FILTER
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_set_filter_configuration(DPS310_handle_t* handle, DPS310_filter_configuration_t* filter_configuration)
+ * \brief Set the pressure filter configuration of a sensor instance (the filter state is reset).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   filter_configuration: Pointer to the filter configuration.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_set_filter_configuration(DPS310_handle_t* handle, DPS310_filter_configuration_t* filter_configuration);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_reset_filter(DPS310_handle_t* handle)
+ * \brief Reset the pressure filter state of a sensor instance (the next sample restarts the filter).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_reset_filter(DPS310_handle_t* handle);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_filter_pressure(DPS310_handle_t* handle, int32_t* pressure, uint32_t number_of_samples)
+ * \brief Filter consecutive compensated pressure samples in place.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   pressure: Array of compensated pressures (in the configured unit).
+ * \param[in]   number_of_samples: Number of samples of the array.
+ * \param[out]  pressure: Array of filtered pressures.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_filter_pressure(DPS310_handle_t* handle, int32_t* pressure, uint32_t number_of_samples);
+
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_filter_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t number_of_samples)
+ * \brief Filter the pressure entries of a FIFO batch in place (temperature entries are left unchanged).
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[in]   samples: FIFO samples given by the DPS310_read_fifo() function.
+ * \param[in]   number_of_samples: Number of samples of the batch.
+ * \param[out]  samples: FIFO samples with filtered pressures.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_filter_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t number_of_samples);
+#endif
+#endif
+
+#ifdef DPS310_DRIVER_STATISTICS
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_get_statistics(DPS310_handle_t* handle, DPS310_statistics_t* statistics)
+ * \brief Get a snapshot of the driver activity counters of a sensor instance.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  statistics: Pointer to the structure that will contain the counters.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_get_statistics(DPS310_handle_t* handle, DPS310_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_reset_statistics(DPS310_handle_t* handle)
+ * \brief Reset the driver activity counters of a sensor instance.
+ * \param[in]   handle: Pointer to the sensor instance.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_reset_statistics(DPS310_handle_t* handle);
+#endif
 
 /*******************************************************************/
 #define DPS310_exit_error(base) { ERROR_check_exit(dps310_status, DPS310_SUCCESS, base) }
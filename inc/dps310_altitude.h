@@ -0,0 +1,108 @@
+/*
+ * dps310_altitude.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __DPS310_ALTITUDE_H__
+#define __DPS310_ALTITUDE_H__
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "types.h"
+
+#ifndef DPS310_DRIVER_DISABLE
+
+/*** DPS310 ALTITUDE macros ***/
+
+// Supported pressure range (both measured and reference pressures).
+#define DPS310_ALTITUDE_PRESSURE_MIN_PA             29696
+#define DPS310_ALTITUDE_PRESSURE_MAX_PA             120320
+
+// Vertical speed filter gains unit (Q16).
+#define DPS310_ALTITUDE_GAIN_ONE                    65536
+
+/*** DPS310 ALTITUDE structures ***/
+
+/*!******************************************************************
+ * \struct DPS310_ALTITUDE_handle_t
+ * \brief DPS310 altitude computation context.
+ *******************************************************************/
+typedef struct {
+    DPS310_pressure_unit_t pressure_unit;
+    int32_t reference_pressure_q6;
+    int32_t reference_ratio;
+    uint32_t reference_reciprocal;
+    // Vertical speed alpha-beta filter.
+    uint32_t alpha;
+    uint32_t beta;
+    uint8_t filter_initialized_flag;
+    uint32_t last_timestamp_us;
+    uint32_t period_us;
+    uint32_t period_reciprocal;
+    int32_t altitude_mm;
+    int32_t vertical_speed_mm_s;
+} DPS310_ALTITUDE_handle_t;
+
+/*** DPS310 ALTITUDE functions ***/
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_ALTITUDE_init_handle(DPS310_ALTITUDE_handle_t* handle, DPS310_pressure_unit_t pressure_unit, int32_t reference_pressure)
+ * \brief Init an altitude computation context.
+ * \param[in]   handle: Pointer to the context.
+ * \param[in]   pressure_unit: Unit of all pressures given to this context (as configured in the sensor instance).
+ * \param[in]   reference_pressure: Pressure of the zero altitude (101325 Pa for the standard atmosphere, QNH or ground pressure).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_init_handle(DPS310_ALTITUDE_handle_t* handle, DPS310_pressure_unit_t pressure_unit, int32_t reference_pressure);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_ALTITUDE_set_reference_pressure(DPS310_ALTITUDE_handle_t* handle, int32_t reference_pressure)
+ * \brief Change the pressure of the zero altitude (the vertical speed filter is restarted).
+ * \param[in]   handle: Pointer to the context.
+ * \param[in]   reference_pressure: Pressure of the zero altitude.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_set_reference_pressure(DPS310_ALTITUDE_handle_t* handle, int32_t reference_pressure);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_ALTITUDE_set_vertical_speed_gains(DPS310_ALTITUDE_handle_t* handle, uint32_t alpha, uint32_t beta)
+ * \brief Set the gains of the vertical speed alpha-beta filter (the filter is restarted).
+ * \param[in]   handle: Pointer to the context.
+ * \param[in]   alpha: Altitude correction gain in Q16 format (0 to DPS310_ALTITUDE_GAIN_ONE).
+ * \param[in]   beta: Vertical speed correction gain in Q16 format (0 to DPS310_ALTITUDE_GAIN_ONE).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_set_vertical_speed_gains(DPS310_ALTITUDE_handle_t* handle, uint32_t alpha, uint32_t beta);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_ALTITUDE_compute(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, int32_t* altitude_mm)
+ * \brief Compute the altitude relative to the reference pressure (standard atmosphere model, error lower than 6.5 mm over the supported pressure range, 5 mm for reference pressures above 40 kPa).
+ * \param[in]   handle: Pointer to the context.
+ * \param[in]   pressure: Measured pressure.
+ * \param[out]  altitude_mm: Pointer to integer that will contain the altitude in mm.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_compute(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, int32_t* altitude_mm);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_ALTITUDE_update(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, uint32_t timestamp_us, int32_t* altitude_mm, int32_t* vertical_speed_mm_s)
+ * \brief Feed a new dated pressure sample to the vertical speed filter (samples less than 1 ms apart are ignored, a gap of more than 2 s restarts the filter).
+ * \param[in]   handle: Pointer to the context.
+ * \param[in]   pressure: Measured pressure.
+ * \param[in]   timestamp_us: Sample date in microseconds (wrapping counter).
+ * \param[out]  altitude_mm: Pointer to integer that will contain the filtered altitude in mm.
+ * \param[out]  vertical_speed_mm_s: Pointer to integer that will contain the vertical speed in mm/s.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_update(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, uint32_t timestamp_us, int32_t* altitude_mm, int32_t* vertical_speed_mm_s);
+
+#endif /* DPS310_DRIVER_DISABLE */
+
+#endif /* __DPS310_ALTITUDE_H__ */
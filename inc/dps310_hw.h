@@ -16,6 +16,13 @@
 
 #ifndef DPS310_DRIVER_DISABLE
 
+/*** DPS310 HW structures ***/
+
+/*!******************************************************************
+ * \brief DPS310 interrupt pin handler (to be called by the hardware interface in interrupt context).
+ *******************************************************************/
+typedef void (*DPS310_HW_interrupt_cb_t)(void* context);
+
 /*** DPS310 HW functions ***/
 
 /*!******************************************************************
@@ -37,8 +44,9 @@ DPS310_status_t DPS310_HW_init(void);
 DPS310_status_t DPS310_HW_de_init(void);
 
 /*!******************************************************************
- * \fn DPS310_status_t DPS310_HW_i2c_write(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag)
+ * \fn DPS310_status_t DPS310_HW_i2c_write(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag)
  * \brief Write data to sensor over I2C bus.
+ * \param[in]   i2c_instance: I2C bus of the sensor.
  * \param[in]   i2c_address: 7-bits sensor address.
  * \param[in]   data: Byte array to send.
  * \param[in]   data_size_bytes: Number of bytes to send.
@@ -46,17 +54,65 @@ DPS310_status_t DPS310_HW_de_init(void);
  * \param[out]  none
  * \retval      Function execution status.
  *******************************************************************/
-DPS310_status_t DPS310_HW_i2c_write(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag);
+DPS310_status_t DPS310_HW_i2c_write(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag);
 
 /*!******************************************************************
- * \fn DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes)
+ * \fn DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes)
  * \brief Read data from sensor over I2C bus.
+ * \param[in]   i2c_instance: I2C bus of the sensor.
  * \param[in]   i2c_address: 7-bits sensor address.
  * \param[in]   data_size_bytes: Number of bytes to read.
  * \param[out]  data: Byte array that will contain the read data.
  * \retval      Function execution status.
  *******************************************************************/
-DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes);
+DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_i2c_write_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_data_size_bytes, uint8_t* rx_data, uint8_t rx_data_size_bytes)
+ * \brief Write then read data in a single I2C transaction with repeated start (optional, default implementation uses DPS310_HW_i2c_write() and DPS310_HW_i2c_read()).
+ * \param[in]   i2c_instance: I2C bus of the sensor.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[in]   tx_data: Byte array to send.
+ * \param[in]   tx_data_size_bytes: Number of bytes to send.
+ * \param[in]   rx_data_size_bytes: Number of bytes to read.
+ * \param[out]  rx_data: Byte array that will contain the read data.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_i2c_write_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_data_size_bytes, uint8_t* rx_data, uint8_t rx_data_size_bytes);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_enable_interrupt(uint8_t i2c_instance, uint8_t i2c_address, DPS310_HW_interrupt_cb_t interrupt_callback, void* context)
+ * \brief Enable the interrupt line connected to the SDO/INT pin of a sensor (active high).
+ * \param[in]   i2c_instance: I2C bus of the sensor.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[in]   interrupt_callback: Function to call with the given context on interrupt.
+ * \param[in]   context: Context to give to the callback.
+ * \param[out]  none
+ * \retval      Function execution status (the default implementation returns DPS310_ERROR_INTERRUPT since no interrupt line is available).
+ *******************************************************************/
+DPS310_status_t DPS310_HW_enable_interrupt(uint8_t i2c_instance, uint8_t i2c_address, DPS310_HW_interrupt_cb_t interrupt_callback, void* context);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_disable_interrupt(uint8_t i2c_instance, uint8_t i2c_address)
+ * \brief Disable the interrupt line of a sensor.
+ * \param[in]   i2c_instance: I2C bus of the sensor.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_disable_interrupt(uint8_t i2c_instance, uint8_t i2c_address);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_wait_interrupt(uint8_t i2c_instance, uint8_t i2c_address, volatile uint8_t* interrupt_flag, uint32_t timeout_ms)
+ * \brief Low power wait ended by the interrupt callback of a sensor (optional, the driver sleeps during the conversion time when it is not implemented).
+ * \param[in]   i2c_instance: I2C bus of the sensor.
+ * \param[in]   i2c_address: 7-bits sensor address.
+ * \param[in]   interrupt_flag: Flag set by the interrupt callback, the function returns as soon as it is not zero.
+ * \param[in]   timeout_ms: Maximum waiting time in ms.
+ * \param[out]  none
+ * \retval      Function execution status (the default implementation returns DPS310_ERROR_INTERRUPT since no interrupt line is available).
+ *******************************************************************/
+DPS310_status_t DPS310_HW_wait_interrupt(uint8_t i2c_instance, uint8_t i2c_address, volatile uint8_t* interrupt_flag, uint32_t timeout_ms);
 
 /*!******************************************************************
  * \fn DPS310_status_t DPS310_HW_delay_milliseconds(uint32_t delay_ms)
@@ -67,6 +123,15 @@ DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_address, uint8_t* data, uint8_t d
  *******************************************************************/
 DPS310_status_t DPS310_HW_delay_milliseconds(uint32_t delay_ms);
 
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_get_timestamp_us(uint32_t* timestamp_us)
+ * \brief Get a free-running timestamp used to date the multiple sensors measurements and to measure the driver latencies.
+ * \param[in]   none
+ * \param[out]  timestamp_us: Pointer to integer that will contain the timestamp in us.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_get_timestamp_us(uint32_t* timestamp_us);
+
 #endif /* DPS310_DRIVER_DISABLE */
 
 #endif /* __DPS310_HW_H__ */
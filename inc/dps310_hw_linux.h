@@ -0,0 +1,84 @@
+/*
+ * dps310_hw_linux.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __DPS310_HW_LINUX_H__
+#define __DPS310_HW_LINUX_H__
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "types.h"
+
+#if !(defined DPS310_DRIVER_DISABLE) && (defined DPS310_DRIVER_HW_LINUX)
+
+/*** DPS310 HW LINUX structures ***/
+
+/*!******************************************************************
+ * \struct DPS310_HW_LINUX_statistics_t
+ * \brief DPS310 Linux backend activity since the last statistics reset.
+ *******************************************************************/
+typedef struct {
+    uint32_t open_count;
+    uint32_t ioctl_count; // One per bus transaction (messages of a transaction are batched).
+    uint32_t i2c_message_count;
+    uint32_t i2c_byte_count; // Excluding slave address bytes.
+    uint32_t sleep_count;
+} DPS310_HW_LINUX_statistics_t;
+
+/*** DPS310 HW LINUX functions ***/
+
+/*!******************************************************************
+ * \fn int DPS310_HW_LINUX_open(uint8_t i2c_instance)
+ * \brief Open the character device of an I2C bus (weak function, can be replaced by a test stand-in).
+ * \param[in]   i2c_instance: Bus number N of the /dev/i2c-N device.
+ * \param[out]  none
+ * \retval      File descriptor of the bus, negative value on failure.
+ *******************************************************************/
+int DPS310_HW_LINUX_open(uint8_t i2c_instance);
+
+/*!******************************************************************
+ * \fn int DPS310_HW_LINUX_ioctl(int fd, unsigned long request, void* argument)
+ * \brief Bus device control (weak function, can be replaced by a test stand-in).
+ * \param[in]   fd: File descriptor of the bus.
+ * \param[in]   request: Device request (I2C_RDWR).
+ * \param[in]   argument: Request argument (struct i2c_rdwr_ioctl_data*).
+ * \param[out]  none
+ * \retval      Negative value on failure.
+ *******************************************************************/
+int DPS310_HW_LINUX_ioctl(int fd, unsigned long request, void* argument);
+
+/*!******************************************************************
+ * \fn int DPS310_HW_LINUX_close(int fd)
+ * \brief Close the character device of an I2C bus (weak function, can be replaced by a test stand-in).
+ * \param[in]   fd: File descriptor of the bus.
+ * \param[out]  none
+ * \retval      Negative value on failure.
+ *******************************************************************/
+int DPS310_HW_LINUX_close(int fd);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_LINUX_get_statistics(DPS310_HW_LINUX_statistics_t* statistics)
+ * \brief Get the backend activity since the last statistics reset.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the structure that will contain the statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_LINUX_get_statistics(DPS310_HW_LINUX_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_LINUX_reset_statistics(void)
+ * \brief Reset the backend activity counters.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_LINUX_reset_statistics(void);
+
+#endif /* DPS310_DRIVER_DISABLE and DPS310_DRIVER_HW_LINUX */
+
+#endif /* __DPS310_HW_LINUX_H__ */
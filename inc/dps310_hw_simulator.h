@@ -0,0 +1,99 @@
+/*
+ * dps310_hw_simulator.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __DPS310_HW_SIMULATOR_H__
+#define __DPS310_HW_SIMULATOR_H__
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "types.h"
+
+#if !(defined DPS310_DRIVER_DISABLE) && (defined DPS310_DRIVER_HW_SIMULATOR)
+
+/*** DPS310 HW SIMULATOR macros ***/
+
+#define DPS310_HW_SIMULATOR_I2C_ADDRESS_FIRST   0x76
+#define DPS310_HW_SIMULATOR_NUMBER_OF_SENSORS   2
+
+#define DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES 18
+
+/*** DPS310 HW SIMULATOR structures ***/
+
+/*!******************************************************************
+ * \struct DPS310_HW_SIMULATOR_statistics_t
+ * \brief DPS310 simulated bus activity since the last statistics reset.
+ *******************************************************************/
+typedef struct {
+    uint32_t i2c_transaction_count;
+    uint32_t i2c_byte_count; // Including register address bytes, excluding slave address bytes.
+    uint32_t time_us; // Simulated wall time (bus transfers and delays).
+} DPS310_HW_SIMULATOR_statistics_t;
+
+/*** DPS310 HW SIMULATOR functions ***/
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_SIMULATOR_set_coefficients_registers(uint8_t i2c_address, uint8_t* coefficients_registers)
+ * \brief Program the calibration coefficients registers of a simulated sensor (kept until the next DPS310_init()).
+ * \param[in]   i2c_address: I2C address of the simulated sensor.
+ * \param[in]   coefficients_registers: Pointer to the DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES registers values, from COEF_C0B to COEF_C30A.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_coefficients_registers(uint8_t i2c_address, uint8_t* coefficients_registers);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_SIMULATOR_set_raw_results(uint8_t i2c_address, int32_t prs_raw, int32_t tmp_raw)
+ * \brief Set the raw values returned by the next conversions of a simulated sensor.
+ * \param[in]   i2c_address: I2C address of the simulated sensor.
+ * \param[in]   prs_raw: Raw pressure result (24-bits signed value).
+ * \param[in]   tmp_raw: Raw temperature result (24-bits signed value).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_raw_results(uint8_t i2c_address, int32_t prs_raw, int32_t tmp_raw);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_SIMULATOR_set_write_read_split(uint8_t write_read_split_flag)
+ * \brief Simulate register reads as a write transaction followed by a read transaction, like the weak DPS310_HW_i2c_write_read() fallback.
+ * \param[in]   write_read_split_flag: 0 for a single transaction with repeated start (default), 1 for two transactions.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_write_read_split(uint8_t write_read_split_flag);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_SIMULATOR_set_interrupt_lines(uint8_t interrupt_lines_flag)
+ * \brief Connect or disconnect the interrupt lines of the simulated sensors.
+ * \param[in]   interrupt_lines_flag: 1 if the lines are connected (default), 0 to make DPS310_HW_enable_interrupt() return DPS310_ERROR_INTERRUPT like the default implementation.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_interrupt_lines(uint8_t interrupt_lines_flag);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_SIMULATOR_get_statistics(DPS310_HW_SIMULATOR_statistics_t* statistics)
+ * \brief Get the simulated bus activity since the last statistics reset.
+ * \param[in]   none
+ * \param[out]  statistics: Pointer to the structure that will contain the statistics.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_get_statistics(DPS310_HW_SIMULATOR_statistics_t* statistics);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_HW_SIMULATOR_reset_statistics(void)
+ * \brief Reset the simulated bus activity counters.
+ * \param[in]   none
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_reset_statistics(void);
+
+#endif /* DPS310_DRIVER_DISABLE and DPS310_DRIVER_HW_SIMULATOR */
+
+#endif /* __DPS310_HW_SIMULATOR_H__ */
@@ -0,0 +1,180 @@
+/*
+ * dps310_log.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __DPS310_LOG_H__
+#define __DPS310_LOG_H__
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "types.h"
+
+#ifndef DPS310_DRIVER_DISABLE
+
+/*** DPS310 LOG macros ***/
+
+// Log header: magic, version, configuration, start timestamp, coefficients and CRC.
+#define DPS310_LOG_HEADER_SIZE_BYTES    48
+
+// Record: type and delta timestamp (1 to 5 bytes) followed by the 3 bytes raw value.
+#define DPS310_LOG_RECORD_SIZE_MAX      8
+
+/*** DPS310 LOG structures ***/
+
+/*!******************************************************************
+ * \struct DPS310_LOG_encoder_t
+ * \brief DPS310 raw samples log encoder context.
+ *******************************************************************/
+typedef struct {
+    uint8_t* buffer;
+    uint32_t buffer_size_bytes;
+    uint32_t buffer_index;
+    uint8_t header_written_flag;
+    uint8_t tmp_raw_written_flag;
+    int32_t tmp_raw;
+    uint32_t timestamp_us;
+} DPS310_LOG_encoder_t;
+
+/*!******************************************************************
+ * \struct DPS310_LOG_decoder_t
+ * \brief DPS310 raw samples log decoder context.
+ *******************************************************************/
+typedef struct {
+    // Header content (the configuration units can be changed before replay).
+    DPS310_coefficients_t coefficients;
+    DPS310_configuration_t configuration;
+    uint8_t header_read_flag;
+    // Decoding state.
+    uint8_t tmp_raw_valid_flag;
+    int32_t tmp_raw;
+    uint32_t timestamp_us;
+} DPS310_LOG_decoder_t;
+
+/*** DPS310 LOG functions ***/
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_init_encoder(DPS310_LOG_encoder_t* encoder, uint8_t* buffer, uint32_t buffer_size_bytes)
+ * \brief Initialize a log encoder writing in a caller-provided buffer.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   buffer: Byte array that will contain the encoded log.
+ * \param[in]   buffer_size_bytes: Size of the buffer (at least DPS310_LOG_HEADER_SIZE_BYTES).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_init_encoder(DPS310_LOG_encoder_t* encoder, uint8_t* buffer, uint32_t buffer_size_bytes);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_write_header(DPS310_LOG_encoder_t* encoder, DPS310_coefficients_t* coefficients, DPS310_configuration_t* configuration, uint32_t timestamp_us)
+ * \brief Start a new log with the calibration and configuration needed to compensate its samples.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   coefficients: Pointer to the calibration coefficients of the sensor (given by DPS310_get_coefficients()).
+ * \param[in]   configuration: Pointer to the configuration used during acquisition.
+ * \param[in]   timestamp_us: Reference timestamp of the first record in us.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_write_header(DPS310_LOG_encoder_t* encoder, DPS310_coefficients_t* coefficients, DPS310_configuration_t* configuration, uint32_t timestamp_us);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_write_temperature(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t tmp_raw)
+ * \brief Append a temperature sample, used to compensate all the following pressure samples (for example the one measured by DPS310_start_streaming()).
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   timestamp_us: Timestamp of the measurement in us.
+ * \param[in]   tmp_raw: Raw temperature result.
+ * \param[out]  none
+ * \retval      Function execution status (nothing is written if the buffer is full).
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_write_temperature(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t tmp_raw);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_write_measurement(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t prs_raw, int32_t tmp_raw)
+ * \brief Append a single measurement (given by DPS310_get_raw_results()), the temperature is only stored when it has changed.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   timestamp_us: Timestamp of the measurement in us.
+ * \param[in]   prs_raw: Raw pressure result.
+ * \param[in]   tmp_raw: Raw temperature result.
+ * \param[out]  none
+ * \retval      Function execution status (nothing is written if the buffer is full).
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_write_measurement(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t prs_raw, int32_t tmp_raw);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_write_fifo(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, uint32_t pressure_period_us, DPS310_fifo_sample_t* samples, uint8_t number_of_samples)
+ * \brief Append a FIFO drain (given by DPS310_read_fifo_raw()), pressure samples are dated backwards from the given timestamp.
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[in]   timestamp_us: Timestamp of the last pressure sample in us.
+ * \param[in]   pressure_period_us: Pressure measurement period in us.
+ * \param[in]   samples: Array of raw FIFO samples.
+ * \param[in]   number_of_samples: Number of samples in the array.
+ * \param[out]  none
+ * \retval      Function execution status (nothing is written if the buffer is too small for the whole drain).
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_write_fifo(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, uint32_t pressure_period_us, DPS310_fifo_sample_t* samples, uint8_t number_of_samples);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_flush(DPS310_LOG_encoder_t* encoder, uint32_t* number_of_bytes)
+ * \brief Give the number of encoded bytes in the buffer and restart writing at its beginning (the log itself continues).
+ * \param[in]   encoder: Pointer to the encoder context.
+ * \param[out]  number_of_bytes: Pointer to integer that will contain the number of bytes to store before the next write.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_flush(DPS310_LOG_encoder_t* encoder, uint32_t* number_of_bytes);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_init_decoder(DPS310_LOG_decoder_t* decoder)
+ * \brief Initialize a log decoder.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_init_decoder(DPS310_LOG_decoder_t* decoder);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_read_header(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes)
+ * \brief Check and decode the log header.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   data: Byte array starting with the log header.
+ * \param[in]   data_size_bytes: Size of the array (at least DPS310_LOG_HEADER_SIZE_BYTES).
+ * \param[out]  none
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_read_header(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_read_samples(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes, uint32_t* timestamp_us, int32_t* prs_raw, int32_t* tmp_raw, uint32_t samples_size, uint32_t* number_of_samples, uint32_t* number_of_bytes)
+ * \brief Decode the records following the header into raw samples arrays (a record split at the end of the data is left for the next call).
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   data: Byte array of records.
+ * \param[in]   data_size_bytes: Size of the array.
+ * \param[in]   samples_size: Maximum number of samples to decode.
+ * \param[out]  timestamp_us: Array that will contain the timestamp of each pressure sample.
+ * \param[out]  prs_raw: Array that will contain the raw pressure samples.
+ * \param[out]  tmp_raw: Array that will contain the raw temperature associated to each pressure sample.
+ * \param[out]  number_of_samples: Pointer to integer that will contain the number of decoded samples.
+ * \param[out]  number_of_bytes: Pointer to integer that will contain the number of consumed bytes.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_read_samples(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes, uint32_t* timestamp_us, int32_t* prs_raw, int32_t* tmp_raw, uint32_t samples_size, uint32_t* number_of_samples, uint32_t* number_of_bytes);
+
+/*!******************************************************************
+ * \fn DPS310_status_t DPS310_LOG_replay(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes, DPS310_sample_t* samples, uint32_t samples_size, uint32_t* number_of_samples, uint32_t* number_of_bytes)
+ * \brief Decode the records following the header and compensate them with DPS310_compensate() and the decoder configuration.
+ * \param[in]   decoder: Pointer to the decoder context.
+ * \param[in]   data: Byte array of records.
+ * \param[in]   data_size_bytes: Size of the array.
+ * \param[in]   samples_size: Maximum number of samples to decode.
+ * \param[out]  samples: Array that will contain the dated and compensated samples.
+ * \param[out]  number_of_samples: Pointer to integer that will contain the number of decoded samples.
+ * \param[out]  number_of_bytes: Pointer to integer that will contain the number of consumed bytes.
+ * \retval      Function execution status.
+ *******************************************************************/
+DPS310_status_t DPS310_LOG_replay(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes, DPS310_sample_t* samples, uint32_t samples_size, uint32_t* number_of_samples, uint32_t* number_of_bytes);
+
+#endif /* DPS310_DRIVER_DISABLE */
+
+#endif /* __DPS310_LOG_H__ */
@@ -19,15 +19,116 @@
 
 /*** DPS310 local macros ***/
 
-#define DPS310_SUB_DELAY_MS                 10
+#ifndef DPS310_DRIVER_POLLING_PERIOD_MS
+#define DPS310_DRIVER_POLLING_PERIOD_MS     1
+#endif
 #define DPS310_TIMEOUT_MS                   2000
+#define DPS310_CONVERSION_TIMEOUT_MARGIN_MS 10
 
 #define DPS310_WRITE_COMMAND_BUFFER_SIZE    2
 
-#define DPS310_SAMPLING_FACTOR_KT           524288
-#define DPS310_SAMPLING_FACTOR_KP           1572864
+#ifdef DPS310_DRIVER_STATIC_CONFIGURATION
+#ifndef DPS310_DRIVER_STATIC_I2C_ADDRESS
+#error "DPS310 driver: DPS310_DRIVER_STATIC_I2C_ADDRESS is required by the static configuration"
+#endif
+#ifndef DPS310_DRIVER_STATIC_I2C_INSTANCE
+#define DPS310_DRIVER_STATIC_I2C_INSTANCE           0
+#endif
+#ifndef DPS310_DRIVER_STATIC_PRESSURE_RATE
+#define DPS310_DRIVER_STATIC_PRESSURE_RATE          DPS310_MEASUREMENT_RATE_1HZ
+#endif
+#ifndef DPS310_DRIVER_STATIC_PRESSURE_OVERSAMPLING
+#define DPS310_DRIVER_STATIC_PRESSURE_OVERSAMPLING  DPS310_OVERSAMPLING_2
+#endif
+#ifndef DPS310_DRIVER_STATIC_TEMPERATURE_RATE
+#define DPS310_DRIVER_STATIC_TEMPERATURE_RATE       DPS310_MEASUREMENT_RATE_1HZ
+#endif
+#ifndef DPS310_DRIVER_STATIC_TEMPERATURE_OVERSAMPLING
+#define DPS310_DRIVER_STATIC_TEMPERATURE_OVERSAMPLING   DPS310_OVERSAMPLING_1
+#endif
+#ifndef DPS310_DRIVER_STATIC_PRESSURE_UNIT
+#define DPS310_DRIVER_STATIC_PRESSURE_UNIT          DPS310_PRESSURE_UNIT_PA
+#endif
+#ifndef DPS310_DRIVER_STATIC_TEMPERATURE_UNIT
+#define DPS310_DRIVER_STATIC_TEMPERATURE_UNIT       DPS310_TEMPERATURE_UNIT_DEGREES
+#endif
+#ifndef DPS310_DRIVER_STATIC_TEMPERATURE_PERIOD
+#define DPS310_DRIVER_STATIC_TEMPERATURE_PERIOD     1
+#endif
+#if (DPS310_DRIVER_STATIC_I2C_ADDRESS < 0) || (DPS310_DRIVER_STATIC_I2C_ADDRESS > 0x7F)
+#error "DPS310 driver: DPS310_DRIVER_STATIC_I2C_ADDRESS is not a 7-bits I2C address"
+#endif
+// Enumeration values can't be checked by the preprocessor (compilation fails on a negative array size otherwise).
+#define DPS310_STATIC_CHECK(name, condition)        typedef char name[(condition) ? 1 : -1]
+// Registers values without the temperature source bit.
+#define DPS310_STATIC_PRS_CFG                       ((uint8_t) ((DPS310_DRIVER_STATIC_PRESSURE_RATE << 4) | (DPS310_DRIVER_STATIC_PRESSURE_OVERSAMPLING)))
+#define DPS310_STATIC_TMP_CFG                       ((uint8_t) ((DPS310_DRIVER_STATIC_TEMPERATURE_RATE << 4) | (DPS310_DRIVER_STATIC_TEMPERATURE_OVERSAMPLING)))
+// Sensor instance accessors resolve to constants.
+#define DPS310_I2C_INSTANCE(handle)         DPS310_DRIVER_STATIC_I2C_INSTANCE
+#define DPS310_I2C_ADDRESS(handle)          DPS310_DRIVER_STATIC_I2C_ADDRESS
+#define DPS310_CONFIGURATION(handle)        (&DPS310_STATIC_CONFIGURATION)
+#define DPS310_PRS_CFG(handle)              DPS310_STATIC_PRS_CFG
+#define DPS310_TMP_CFG(handle)              ((uint8_t) (((handle)->tmp_coef_srce << 7) | DPS310_STATIC_TMP_CFG))
+#else
+#define DPS310_I2C_INSTANCE(handle)         ((handle)->i2c_instance)
+#define DPS310_I2C_ADDRESS(handle)          ((handle)->i2c_address)
+#define DPS310_CONFIGURATION(handle)        (&((handle)->configuration))
+#define DPS310_PRS_CFG(handle)              ((handle)->prs_cfg)
+#define DPS310_TMP_CFG(handle)              ((handle)->tmp_cfg)
+#endif
+
+#define DPS310_BACKGROUND_MODE_BUDGET_US    1000000
+
+#define DPS310_COMPENSATION_FRACTIONAL_BITS 24
+// Q24 format scale (coefficients are multiplied since left shifts of negative values are undefined).
+#define DPS310_COMPENSATION_ONE             (1LL << DPS310_COMPENSATION_FRACTIONAL_BITS)
 
 #define DPS310_NUMBER_OF_COEF_REGISTERS     18
+// Coefficients and temperature source are read in a single burst (COEF_C0B to COEF_SRCE).
+#define DPS310_COEF_BURST_SIZE_BYTES        (DPS310_REGISTER_COEF_COEF_SRCE - DPS310_REGISTER_COEF_C0B + 1)
+// Init probe burst (MEAS_CFG to COEF_SRCE): ready flags, product ID, coefficients and temperature source.
+#define DPS310_PROBE_BURST_SIZE_BYTES       (DPS310_REGISTER_COEF_COEF_SRCE - DPS310_REGISTER_MEAS_CFG + 1)
+
+#define DPS310_PRODUCT_ID                   0x10
+#define DPS310_NUMBER_OF_RESULT_REGISTERS   6
+#define DPS310_RESULT_SIZE_BYTES            3
+
+#define DPS310_FIFO_EMPTY_RAW_VALUE         (-8388608)
+#define DPS310_FIFO_DEPTH                   32
+
+// Timeout of the non-blocking flags polls when DPS310_HW_get_timestamp_us() does not advance.
+#define DPS310_PROCESS_POLL_COUNT_MAX       1000
+
+#define DPS310_FILTER_FRACTIONAL_BITS       8
+#define DPS310_FILTER_MEDIAN_SIZE_DEFAULT   3
+#define DPS310_FILTER_IIR_ALPHA_DEFAULT     16384 // 0.25
+// Q/R = 0.0117: steady state gain of 0.103 whatever the pressure unit.
+#define DPS310_FILTER_KALMAN_Q_DEFAULT      3
+#define DPS310_FILTER_KALMAN_R_DEFAULT      256
+
+#ifdef DPS310_DRIVER_STATISTICS
+#define DPS310_STATISTICS_ADD(handle, counter, value)   { (handle)->statistics.counter += (value); }
+#define DPS310_STATISTICS_TIMEOUT(handle, timeout_error) { _DPS310_count_timeout(handle, timeout_error); }
+#define DPS310_STATISTICS_CALL_START                    uint32_t statistics_start_us = _DPS310_get_timestamp_us();
+#define DPS310_STATISTICS_CALL_END(handle, call)        { _DPS310_update_call_statistics(handle, call, statistics_start_us); }
+#else
+#define DPS310_STATISTICS_ADD(handle, counter, value)
+#define DPS310_STATISTICS_TIMEOUT(handle, timeout_error)
+#define DPS310_STATISTICS_CALL_START
+#define DPS310_STATISTICS_CALL_END(handle, call)
+#endif
+
+// Publish samples buffer entries before the write index (and release them before the read index).
+#define DPS310_MEMORY_BARRIER()             __sync_synchronize()
+
+#define DPS310_CALIBRATION_BLOB_VERSION     0x03
+#define DPS310_CALIBRATION_BLOB_INDEX_VERSION       0
+#define DPS310_CALIBRATION_BLOB_INDEX_PRODUCT_ID    1
+#define DPS310_CALIBRATION_BLOB_INDEX_COEF_SRCE     2
+#define DPS310_CALIBRATION_BLOB_INDEX_COEFFICIENTS  3
+#define DPS310_CALIBRATION_BLOB_INDEX_CRC           (DPS310_CALIBRATION_BLOB_INDEX_COEFFICIENTS + DPS310_NUMBER_OF_COEF_REGISTERS)
+#define DPS310_CALIBRATION_BLOB_CRC_POLYNOMIAL      0x1021
+#define DPS310_CALIBRATION_BLOB_CRC_INIT            0xFFFF
 
 /*** DPS310 local structures ***/
 
@@ -69,92 +170,332 @@ typedef enum {
     DPS310_REGISTER_LAST
 } DPS310_register_t;
 
-/*******************************************************************/
-typedef struct {
-    // Measurements.
-    int32_t tmp_raw;
-    int32_t prs_raw;
-    // Calibration coefficients.
-    uint8_t coef_ready_flag;
-    int32_t coef_c0;
-    int32_t coef_c1;
-    int32_t coef_c00;
-    int32_t coef_c10;
-    int32_t coef_c01;
-    int32_t coef_c11;
-    int32_t coef_c20;
-    int32_t coef_c21;
-    int32_t coef_c30;
-} DPS310_context_t;
-
 /*** DPS310 local global variables ***/
 
-static DPS310_context_t dps310_ctx = { .coef_ready_flag = 0 };
+#ifdef DPS310_DRIVER_STATIC_CONFIGURATION
+static const DPS310_configuration_t DPS310_STATIC_CONFIGURATION = {
+    DPS310_DRIVER_STATIC_PRESSURE_RATE,
+    DPS310_DRIVER_STATIC_PRESSURE_OVERSAMPLING,
+    DPS310_DRIVER_STATIC_TEMPERATURE_RATE,
+    DPS310_DRIVER_STATIC_TEMPERATURE_OVERSAMPLING,
+    DPS310_DRIVER_STATIC_PRESSURE_UNIT,
+    DPS310_DRIVER_STATIC_TEMPERATURE_UNIT,
+    DPS310_DRIVER_STATIC_TEMPERATURE_PERIOD
+};
+DPS310_STATIC_CHECK(DPS310_STATIC_PRESSURE_RATE_CHECK, (DPS310_DRIVER_STATIC_PRESSURE_RATE < DPS310_MEASUREMENT_RATE_LAST));
+DPS310_STATIC_CHECK(DPS310_STATIC_PRESSURE_OVERSAMPLING_CHECK, (DPS310_DRIVER_STATIC_PRESSURE_OVERSAMPLING < DPS310_OVERSAMPLING_LAST));
+DPS310_STATIC_CHECK(DPS310_STATIC_TEMPERATURE_RATE_CHECK, (DPS310_DRIVER_STATIC_TEMPERATURE_RATE < DPS310_MEASUREMENT_RATE_LAST));
+DPS310_STATIC_CHECK(DPS310_STATIC_TEMPERATURE_OVERSAMPLING_CHECK, (DPS310_DRIVER_STATIC_TEMPERATURE_OVERSAMPLING < DPS310_OVERSAMPLING_LAST));
+DPS310_STATIC_CHECK(DPS310_STATIC_PRESSURE_UNIT_CHECK, (DPS310_DRIVER_STATIC_PRESSURE_UNIT < DPS310_PRESSURE_UNIT_LAST));
+DPS310_STATIC_CHECK(DPS310_STATIC_TEMPERATURE_UNIT_CHECK, (DPS310_DRIVER_STATIC_TEMPERATURE_UNIT < DPS310_TEMPERATURE_UNIT_LAST));
+#endif
+
+// Scale factors are written k = m * 2^e (m odd), so that raw / k = (raw * round(2^32 / m)) >> (32 + e - 24) in Q24 format.
+static const int64_t DPS310_SCALE_FACTOR_RECIPROCAL[DPS310_OVERSAMPLING_LAST] = { 4294967296, 1431655765, 613566757, 286331153, 138547332, 68174084, 33818640, 16843009 };
+static const uint8_t DPS310_SCALE_FACTOR_SHIFT[DPS310_OVERSAMPLING_LAST] = { 27, 27, 27, 27, 21, 21, 21, 21 };
+static const uint32_t DPS310_CONVERSION_TIME_US[DPS310_OVERSAMPLING_LAST] = { 3600, 5200, 8400, 14800, 27600, 53200, 104400, 206800 };
 
 /*** DPS310 local functions ***/
 
 /*******************************************************************/
-static DPS310_status_t _DPS310_write_register(uint8_t i2c_address, DPS310_register_t register_address, uint8_t value) {
+static uint32_t _DPS310_get_timestamp_us(void) {
+    // Local variables.
+    uint32_t timestamp_us = 0;
+    // Timestamps are informative, errors are ignored.
+    if (DPS310_HW_get_timestamp_us(&timestamp_us) != DPS310_SUCCESS) {
+        timestamp_us = 0;
+    }
+    return timestamp_us;
+}
+
+#ifdef DPS310_DRIVER_STATISTICS
+
+/*******************************************************************/
+static void _DPS310_update_call_statistics(DPS310_handle_t* handle, DPS310_statistics_call_t call, uint32_t start_us) {
+    // Local variables.
+    DPS310_call_statistics_t* call_statistics = NULL;
+    uint32_t latency_us = 0;
+    // Check parameters.
+    if (handle == NULL) return;
+    call_statistics = &(handle->statistics.calls[call]);
+    latency_us = (_DPS310_get_timestamp_us() - start_us);
+    // Update latency.
+    call_statistics->count++;
+    call_statistics->total_us += latency_us;
+    if (latency_us < call_statistics->min_us) {
+        call_statistics->min_us = latency_us;
+    }
+    if (latency_us > call_statistics->max_us) {
+        call_statistics->max_us = latency_us;
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_count_timeout(DPS310_handle_t* handle, DPS310_status_t timeout_error) {
+    // Check error.
+    switch (timeout_error) {
+    case DPS310_ERROR_COEFFICIENTS_TIMEOUT:
+        handle->statistics.coefficients_timeout_count++;
+        break;
+    case DPS310_ERROR_SENSOR_TIMEOUT:
+        handle->statistics.sensor_timeout_count++;
+        break;
+    case DPS310_ERROR_TEMPERATURE_TIMEOUT:
+        handle->statistics.temperature_timeout_count++;
+        break;
+    case DPS310_ERROR_PRESSURE_TIMEOUT:
+        handle->statistics.pressure_timeout_count++;
+        break;
+    default:
+        break;
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_reset_statistics(DPS310_handle_t* handle) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Reset counters.
+    handle->statistics.i2c_transaction_count = 0;
+    handle->statistics.i2c_byte_count = 0;
+    handle->statistics.flag_poll_count = 0;
+    handle->statistics.delay_ms = 0;
+    handle->statistics.coefficients_timeout_count = 0;
+    handle->statistics.sensor_timeout_count = 0;
+    handle->statistics.temperature_timeout_count = 0;
+    handle->statistics.pressure_timeout_count = 0;
+    for (idx = 0; idx < DPS310_STATISTICS_CALL_LAST; idx++) {
+        handle->statistics.calls[idx].count = 0;
+        handle->statistics.calls[idx].min_us = 0xFFFFFFFF;
+        handle->statistics.calls[idx].max_us = 0;
+        handle->statistics.calls[idx].average_us = 0;
+        handle->statistics.calls[idx].total_us = 0;
+    }
+}
+#endif
+
+/*******************************************************************/
+static void _DPS310_apply_configuration(DPS310_handle_t* handle, const DPS310_configuration_t* configuration) {
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    // Store configuration.
+    handle->configuration = (*configuration);
+    // Registers values (temperature sensor used for the calibration coefficients).
+    handle->prs_cfg = (uint8_t) ((configuration->pressure_rate << 4) | (configuration->pressure_oversampling));
+    handle->tmp_cfg = (uint8_t) ((handle->tmp_coef_srce << 7) | (configuration->temperature_rate << 4) | (configuration->temperature_oversampling));
+#endif
+    handle->cfg_reg = 0x00;
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    // Interrupts are active high.
+    if (handle->interrupt_mask != 0) {
+        handle->cfg_reg = (uint8_t) (0x80 | (handle->interrupt_mask << 4));
+    }
+#endif
+    // Result shift is required above 8 times oversampling.
+    if (configuration->pressure_oversampling > DPS310_OVERSAMPLING_8) {
+        handle->cfg_reg |= (0b1 << 2);
+    }
+    if (configuration->temperature_oversampling > DPS310_OVERSAMPLING_8) {
+        handle->cfg_reg |= (0b1 << 3);
+    }
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_write_register(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t value) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
     uint8_t register_write_command[DPS310_WRITE_COMMAND_BUFFER_SIZE] = { register_address, value };
+    // Handle is not used in static configuration without statistics.
+    UNUSED(handle);
     // I2C transfer.
-    status = DPS310_HW_i2c_write(i2c_address, register_write_command, DPS310_WRITE_COMMAND_BUFFER_SIZE, 1);
+    DPS310_STATISTICS_ADD(handle, i2c_transaction_count, 1);
+    DPS310_STATISTICS_ADD(handle, i2c_byte_count, DPS310_WRITE_COMMAND_BUFFER_SIZE);
+    status = DPS310_HW_i2c_write(DPS310_I2C_INSTANCE(handle), DPS310_I2C_ADDRESS(handle), register_write_command, DPS310_WRITE_COMMAND_BUFFER_SIZE, 1);
     if (status != DPS310_SUCCESS) goto errors;
 errors:
     return status;
 }
 
 /*******************************************************************/
-static DPS310_status_t _DPS310_read_register(uint8_t i2c_address, DPS310_register_t register_address, uint8_t* value) {
+static uint8_t _DPS310_is_shadow_register_up_to_date(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t value) {
+    // Local variables.
+    uint8_t shadow_index = (uint8_t) (register_address - DPS310_REGISTER_PRS_CFG);
+    // Check shadow copy.
+    return ((((handle->shadow_registers_valid_mask >> shadow_index) & 0x01) != 0) && (handle->shadow_registers[shadow_index] == value)) ? 1 : 0;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_write_configuration_register(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t value) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
-    DPS310_register_t local_addr = register_address;
-    // I2C transfer.
-    status = DPS310_HW_i2c_write(i2c_address, &local_addr, 1, 1);
+    uint8_t shadow_index = (uint8_t) (register_address - DPS310_REGISTER_PRS_CFG);
+    // Skip write if the sensor already contains the value.
+    if (_DPS310_is_shadow_register_up_to_date(handle, register_address, value) != 0) goto errors;
+    // Invalidate shadow copy during the transfer.
+    handle->shadow_registers_valid_mask &= (uint8_t) ~(0b1 << shadow_index);
+    status = _DPS310_write_register(handle, register_address, value);
     if (status != DPS310_SUCCESS) goto errors;
-    status = DPS310_HW_i2c_read(i2c_address, value, 1);
+    // Update shadow copy.
+    handle->shadow_registers[shadow_index] = value;
+    handle->shadow_registers_valid_mask |= (uint8_t) (0b1 << shadow_index);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_read_registers(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t local_addr = (uint8_t) register_address;
+    // Handle is not used in static configuration without statistics.
+    UNUSED(handle);
+    // I2C transfer with repeated start (auto-increment method for multiple registers).
+    DPS310_STATISTICS_ADD(handle, i2c_transaction_count, 1);
+    DPS310_STATISTICS_ADD(handle, i2c_byte_count, (1 + data_size_bytes));
+    status = DPS310_HW_i2c_write_read(DPS310_I2C_INSTANCE(handle), DPS310_I2C_ADDRESS(handle), &local_addr, 1, data, data_size_bytes);
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_read_register(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t* value) {
+    // Single register read.
+    return _DPS310_read_registers(handle, register_address, value, 1);
+}
+
+/*******************************************************************/
+static uint32_t _DPS310_get_conversion_time_ms(DPS310_oversampling_t oversampling) {
+    // Round up to the next millisecond.
+    return ((DPS310_CONVERSION_TIME_US[oversampling] + 999) / 1000);
+}
+
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+/*******************************************************************/
+static void _DPS310_interrupt_handler(void* context) {
+    // Local variables.
+    DPS310_handle_t* handle = (DPS310_handle_t*) context;
+    // Interrupt context: no bus access, status register is read by the next driver call.
+    handle->interrupt_flag = 1;
+    if (handle->interrupt_callback != NULL) {
+        handle->interrupt_callback();
+    }
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_update_interrupt_status(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t int_sts = 0;
+    // Read status register only after an interrupt.
+    if (handle->interrupt_flag == 0) goto errors;
+    handle->interrupt_flag = 0;
+    // Reading the register clears the interrupt, keep all pending sources.
+    status = _DPS310_read_register(handle, DPS310_REGISTER_INT_STS, &int_sts);
     if (status != DPS310_SUCCESS) goto errors;
+    handle->interrupt_status |= (int_sts & DPS310_INTERRUPT_ALL);
 errors:
     return status;
 }
+#endif
 
 /*******************************************************************/
-static DPS310_status_t _DPS310_wait_flag(uint8_t i2c_address, DPS310_register_t register_address, uint8_t bit_index, DPS310_status_t timeout_error) {
+static DPS310_status_t _DPS310_read_flag(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t bit_index, DPS310_interrupt_t interrupt, uint8_t* flag_value) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
     uint8_t reg_value = 0;
-    uint32_t loop_count_ms = 0;
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    // Use interrupt status when enabled.
+    if ((handle->interrupt_mask & interrupt) != 0) {
+        status = _DPS310_update_interrupt_status(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+        (*flag_value) = ((handle->interrupt_status & interrupt) != 0) ? 1 : 0;
+        handle->interrupt_status &= (uint8_t) ~interrupt;
+        goto errors;
+    }
+#else
+    UNUSED(interrupt);
+#endif
     // Read register.
-    status = _DPS310_read_register(i2c_address, register_address, &reg_value);
+    DPS310_STATISTICS_ADD(handle, flag_poll_count, 1);
+    status = _DPS310_read_register(handle, register_address, &reg_value);
+    if (status != DPS310_SUCCESS) goto errors;
+    (*flag_value) = ((reg_value & (0b1 << bit_index)) != 0) ? 1 : 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static uint32_t _DPS310_get_flag_timeout_ms(uint32_t conversion_time_ms) {
+    // Conversions are bounded by twice their expected time, other flags by the generic timeout.
+    return ((conversion_time_ms != 0) ? ((conversion_time_ms << 1) + DPS310_CONVERSION_TIMEOUT_MARGIN_MS) : DPS310_TIMEOUT_MS);
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_wait_flag(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t bit_index, DPS310_interrupt_t interrupt, uint32_t conversion_time_ms, DPS310_status_t timeout_error) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t flag_value = 0;
+    uint32_t loop_count_ms = 0;
+    uint32_t timeout_ms = _DPS310_get_flag_timeout_ms(conversion_time_ms);
+    uint32_t start_us = _DPS310_get_timestamp_us();
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    if ((handle->interrupt_mask & interrupt) != 0) {
+        // Interrupt may already be pending.
+        status = _DPS310_read_flag(handle, register_address, bit_index, interrupt, &flag_value);
+        if ((status != DPS310_SUCCESS) || (flag_value != 0)) goto errors;
+        // Single low power wait ended by the interrupt handler.
+        status = DPS310_HW_wait_interrupt(DPS310_I2C_INSTANCE(handle), DPS310_I2C_ADDRESS(handle), &(handle->interrupt_flag), timeout_ms);
+        if (status == DPS310_SUCCESS) {
+            status = _DPS310_read_flag(handle, register_address, bit_index, interrupt, &flag_value);
+            if ((status == DPS310_SUCCESS) && (flag_value == 0)) {
+                DPS310_STATISTICS_TIMEOUT(handle, timeout_error);
+                status = timeout_error;
+            }
+            goto errors;
+        }
+        // Sleep during the conversion time when the hardware can not wait for the interrupt.
+        if (status != DPS310_ERROR_INTERRUPT) goto errors;
+        status = DPS310_SUCCESS;
+    }
+#endif
+    // Sleep during the expected conversion time before polling.
+    if (conversion_time_ms != 0) {
+        DPS310_STATISTICS_ADD(handle, delay_ms, conversion_time_ms);
+        status = DPS310_HW_delay_milliseconds(conversion_time_ms);
+        if (status != DPS310_SUCCESS) goto errors;
+        loop_count_ms = conversion_time_ms;
+    }
+    // Read flag.
+    status = _DPS310_read_flag(handle, register_address, bit_index, interrupt, &flag_value);
     if (status != DPS310_SUCCESS) goto errors;
     // Wait for flag to be set.
-    while ((reg_value & (0b1 << bit_index)) == 0) {
+    while (flag_value == 0) {
         // Low power delay.
-        status = DPS310_HW_delay_milliseconds(DPS310_SUB_DELAY_MS);
+        DPS310_STATISTICS_ADD(handle, delay_ms, DPS310_DRIVER_POLLING_PERIOD_MS);
+        status = DPS310_HW_delay_milliseconds(DPS310_DRIVER_POLLING_PERIOD_MS);
         if (status != DPS310_SUCCESS) goto errors;
         // Exit if timeout.
-        loop_count_ms += DPS310_SUB_DELAY_MS;
-        if (loop_count_ms > DPS310_TIMEOUT_MS) {
+        loop_count_ms += DPS310_DRIVER_POLLING_PERIOD_MS;
+        if (loop_count_ms > timeout_ms) {
+            DPS310_STATISTICS_TIMEOUT(handle, timeout_error);
             status = timeout_error;
             goto errors;
         }
-        // Read register.
-        status = _DPS310_read_register(i2c_address, register_address, &reg_value);
+        // Read flag.
+        status = _DPS310_read_flag(handle, register_address, bit_index, interrupt, &flag_value);
         if (status != DPS310_SUCCESS) goto errors;
     }
 errors:
+    // Update wait time with the actual elapsed time (delays may last longer than requested).
+    handle->wait_time_us += (_DPS310_get_timestamp_us() - start_us);
     return status;
 }
 
 /*******************************************************************/
-static DPS310_status_t _DPS310_read_calibration_coefficients(uint8_t i2c_address) {
+static DPS310_status_t _DPS310_decode_coefficients(uint8_t* coef_registers, DPS310_coefficients_t* coefficients) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
     MATH_status_t math_status = MATH_SUCCESS;
-    uint8_t local_addr = DPS310_REGISTER_COEF_C0B;
-    uint8_t idx = 0;
-    uint8_t coef_registers[DPS310_NUMBER_OF_COEF_REGISTERS];
     uint32_t c0 = 0;
     uint32_t c1 = 0;
     uint32_t c00 = 0;
@@ -164,17 +505,6 @@ static DPS310_status_t _DPS310_read_calibration_coefficients(uint8_t i2c_address
     uint32_t c20 = 0;
     uint32_t c21 = 0;
     uint32_t c30 = 0;
-    // Reset all coefficients.
-    for (idx = 0; idx < DPS310_NUMBER_OF_COEF_REGISTERS; idx++)
-        coef_registers[idx] = 0;
-    // Wait for coefficients to be ready for reading.
-    status = _DPS310_wait_flag(i2c_address, DPS310_REGISTER_MEAS_CFG, 7, DPS310_ERROR_COEFFICIENTS_TIMEOUT);
-    if (status != DPS310_SUCCESS) goto errors;
-    // Read all coefficients with auto-increment method.
-    status = DPS310_HW_i2c_write(i2c_address, &local_addr, 1, 1);
-    if (status != DPS310_SUCCESS) goto errors;
-    status = DPS310_HW_i2c_read(i2c_address, coef_registers, DPS310_NUMBER_OF_COEF_REGISTERS);
-    if (status != DPS310_SUCCESS) goto errors;
     // Compute coefficients.
     c0 |= (coef_registers[0] << 4) | ((coef_registers[1] & 0xF0) >> 4);
     c1 |= ((coef_registers[1] & 0x0F) << 8) | (coef_registers[2]);
@@ -186,167 +516,1673 @@ static DPS310_status_t _DPS310_read_calibration_coefficients(uint8_t i2c_address
     c21 |= (coef_registers[14] << 8) | (coef_registers[15]);
     c30 |= (coef_registers[16] << 8) | (coef_registers[17]);
     // Convert to sign values.
-    math_status = MATH_two_complement_to_integer(c0, 11, &dps310_ctx.coef_c0);
+    math_status = MATH_two_complement_to_integer(c0, 11, &coefficients->c0);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c1, 11, &dps310_ctx.coef_c1);
+    math_status = MATH_two_complement_to_integer(c1, 11, &coefficients->c1);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c00, 19, &dps310_ctx.coef_c00);
+    math_status = MATH_two_complement_to_integer(c00, 19, &coefficients->c00);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c01, 15, &dps310_ctx.coef_c01);
+    math_status = MATH_two_complement_to_integer(c01, 15, &coefficients->c01);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c10, 19, &dps310_ctx.coef_c10);
+    math_status = MATH_two_complement_to_integer(c10, 19, &coefficients->c10);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c11, 15, &dps310_ctx.coef_c11);
+    math_status = MATH_two_complement_to_integer(c11, 15, &coefficients->c11);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c20, 15, &dps310_ctx.coef_c20);
+    math_status = MATH_two_complement_to_integer(c20, 15, &coefficients->c20);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c21, 15, &dps310_ctx.coef_c21);
+    math_status = MATH_two_complement_to_integer(c21, 15, &coefficients->c21);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    math_status = MATH_two_complement_to_integer(c30, 15, &dps310_ctx.coef_c30);
+    math_status = MATH_two_complement_to_integer(c30, 15, &coefficients->c30);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
-    // Set flag.
-    dps310_ctx.coef_ready_flag = 1;
 errors:
     return status;
 }
 
 /*******************************************************************/
-static DPS310_status_t _DPS310_compute_raw_temperature(uint8_t i2c_address) {
+static void _DPS310_encode_coefficients(DPS310_coefficients_t* coefficients, uint8_t* coef_registers) {
+    // Local variables.
+    uint32_t c0 = ((uint32_t) coefficients->c0) & 0x00000FFF;
+    uint32_t c1 = ((uint32_t) coefficients->c1) & 0x00000FFF;
+    uint32_t c00 = ((uint32_t) coefficients->c00) & 0x000FFFFF;
+    uint32_t c10 = ((uint32_t) coefficients->c10) & 0x000FFFFF;
+    // Same layout as the sensor registers.
+    coef_registers[0] = (uint8_t) (c0 >> 4);
+    coef_registers[1] = (uint8_t) (((c0 & 0x0F) << 4) | (c1 >> 8));
+    coef_registers[2] = (uint8_t) (c1);
+    coef_registers[3] = (uint8_t) (c00 >> 12);
+    coef_registers[4] = (uint8_t) (c00 >> 4);
+    coef_registers[5] = (uint8_t) (((c00 & 0x0F) << 4) | (c10 >> 16));
+    coef_registers[6] = (uint8_t) (c10 >> 8);
+    coef_registers[7] = (uint8_t) (c10);
+    coef_registers[8] = (uint8_t) (coefficients->c01 >> 8);
+    coef_registers[9] = (uint8_t) (coefficients->c01);
+    coef_registers[10] = (uint8_t) (coefficients->c11 >> 8);
+    coef_registers[11] = (uint8_t) (coefficients->c11);
+    coef_registers[12] = (uint8_t) (coefficients->c20 >> 8);
+    coef_registers[13] = (uint8_t) (coefficients->c20);
+    coef_registers[14] = (uint8_t) (coefficients->c21 >> 8);
+    coef_registers[15] = (uint8_t) (coefficients->c21);
+    coef_registers[16] = (uint8_t) (coefficients->c30 >> 8);
+    coef_registers[17] = (uint8_t) (coefficients->c30);
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_load_coefficients(DPS310_handle_t* handle, uint8_t* coef_registers) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
-    MATH_status_t math_status = MATH_SUCCESS;
-    uint8_t read_byte = 0;
-    uint32_t tmp_raw = 0;
-    // Wait for sensor to be ready.
-    status = _DPS310_wait_flag(i2c_address, DPS310_REGISTER_MEAS_CFG, 6, DPS310_ERROR_SENSOR_TIMEOUT);
+    // Registers buffer starts at COEF_C0B and ends at COEF_SRCE.
+    status = _DPS310_decode_coefficients(coef_registers, &(handle->coefficients));
     if (status != DPS310_SUCCESS) goto errors;
-    // Trigger temperature measurement (external sensor, rate=1meas/s, no oversampling).
-    status = _DPS310_write_register(i2c_address, DPS310_REGISTER_TMP_CFG, 0x80);
-    if (status != DPS310_SUCCESS) goto errors;
-    status = _DPS310_write_register(i2c_address, DPS310_REGISTER_MEAS_CFG, 0x02);
-    if (status != DPS310_SUCCESS) goto errors;
-    // Wait for temperature to be ready.
-    status = _DPS310_wait_flag(i2c_address, DPS310_REGISTER_MEAS_CFG, 5, DPS310_ERROR_TEMPERATURE_TIMEOUT);
+    // Temperature measurements must use the sensor the coefficients are based on (TMP_COEF_SRCE bit).
+    handle->tmp_coef_srce = ((coef_registers[DPS310_COEF_BURST_SIZE_BYTES - 1] >> 7) & 0x01);
+    _DPS310_apply_configuration(handle, DPS310_CONFIGURATION(handle));
+    // Set flag.
+    handle->coef_ready_flag = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_read_coefficients_registers(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t idx = 0;
+    uint8_t coef_registers[DPS310_COEF_BURST_SIZE_BYTES];
+    // Reset all coefficients.
+    for (idx = 0; idx < DPS310_COEF_BURST_SIZE_BYTES; idx++)
+        coef_registers[idx] = 0;
+    // Read all coefficients and temperature source with auto-increment method.
+    status = _DPS310_read_registers(handle, DPS310_REGISTER_COEF_C0B, coef_registers, DPS310_COEF_BURST_SIZE_BYTES);
     if (status != DPS310_SUCCESS) goto errors;
-    // Read temperature.
-    // B2.
-    status = _DPS310_read_register(i2c_address, DPS310_REGISTER_TMP_B2, &read_byte);
+    status = _DPS310_load_coefficients(handle, coef_registers);
     if (status != DPS310_SUCCESS) goto errors;
-    tmp_raw |= (read_byte << 16);
-    // B1.
-    status = _DPS310_read_register(i2c_address, DPS310_REGISTER_TMP_B1, &read_byte);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static uint16_t _DPS310_compute_calibration_blob_crc(uint8_t* data, uint8_t size_bytes) {
+    // Local variables.
+    uint16_t crc = DPS310_CALIBRATION_BLOB_CRC_INIT;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // CRC-16-CCITT.
+    for (idx = 0; idx < size_bytes; idx++) {
+        crc ^= (uint16_t) (data[idx] << 8);
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x8000) != 0) ? (uint16_t) ((crc << 1) ^ DPS310_CALIBRATION_BLOB_CRC_POLYNOMIAL) : (uint16_t) (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_read_calibration_coefficients(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Wait for coefficients to be ready for reading.
+    status = _DPS310_wait_flag(handle, DPS310_REGISTER_MEAS_CFG, 7, DPS310_INTERRUPT_NONE, 0, DPS310_ERROR_COEFFICIENTS_TIMEOUT);
     if (status != DPS310_SUCCESS) goto errors;
-    tmp_raw |= (read_byte << 8);
-    // B0.
-    status = _DPS310_read_register(i2c_address, DPS310_REGISTER_TMP_B0, &read_byte);
+    // Read coefficients.
+    status = _DPS310_read_coefficients_registers(handle);
     if (status != DPS310_SUCCESS) goto errors;
-    tmp_raw |= read_byte;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_decode_raw_result(uint8_t* result_registers, int32_t* raw_result) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    MATH_status_t math_status = MATH_SUCCESS;
+    uint32_t raw = 0;
+    // Build 24-bits value from B2, B1 and B0 registers.
+    raw = ((uint32_t) result_registers[0] << 16) | ((uint32_t) result_registers[1] << 8) | ((uint32_t) result_registers[2]);
     // Compute two complement.
-    math_status = MATH_two_complement_to_integer(tmp_raw, 23, &dps310_ctx.tmp_raw);
+    math_status = MATH_two_complement_to_integer(raw, 23, raw_result);
     MATH_exit_error(DPS310_ERROR_BASE_MATH);
 errors:
     return status;
 }
 
 /*******************************************************************/
-static DPS310_status_t _DPS310_compute_raw_pressure(uint8_t i2c_address) {
+static DPS310_status_t _DPS310_read_raw_result(DPS310_handle_t* handle, DPS310_register_t b2_register_address, int32_t* raw_result) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
-    MATH_status_t math_status = MATH_SUCCESS;
-    uint8_t read_byte = 0;
-    uint32_t prs_raw = 0;
-    // Wait for sensor to be ready.
-    status = _DPS310_wait_flag(i2c_address, DPS310_REGISTER_MEAS_CFG, 6, DPS310_ERROR_SENSOR_TIMEOUT);
+    uint8_t result_registers[DPS310_RESULT_SIZE_BYTES];
+#ifdef DPS310_DRIVER_DISABLE_BURST_READ
+    uint8_t idx = 0;
+    // Read B2, B1 and B0 registers one by one.
+    for (idx = 0; idx < DPS310_RESULT_SIZE_BYTES; idx++) {
+        status = _DPS310_read_register(handle, (b2_register_address + idx), &(result_registers[idx]));
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+#else
+    // Read B2, B1 and B0 registers with auto-increment method.
+    status = _DPS310_read_registers(handle, b2_register_address, result_registers, DPS310_RESULT_SIZE_BYTES);
     if (status != DPS310_SUCCESS) goto errors;
-    // Trigger pressure measurement (rate=1meas/s, no oversampling).
-    status = _DPS310_write_register(i2c_address, DPS310_REGISTER_PRS_CFG, 0x01);
+#endif
+    status = _DPS310_decode_raw_result(result_registers, raw_result);
     if (status != DPS310_SUCCESS) goto errors;
-    status = _DPS310_write_register(i2c_address, DPS310_REGISTER_MEAS_CFG, 0x01);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_read_raw_results(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+#ifndef DPS310_DRIVER_DISABLE_BURST_READ
+    uint8_t result_registers[DPS310_NUMBER_OF_RESULT_REGISTERS];
+#endif
+    // Pressure-only measurement.
+    if (handle->temperature_measurement_flag == 0) {
+        status = _DPS310_read_raw_result(handle, DPS310_REGISTER_PRS_B2, &handle->prs_raw);
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->temperature_age++;
+        goto errors;
+    }
+#ifdef DPS310_DRIVER_DISABLE_BURST_READ
+    // Read results one by one.
+    status = _DPS310_read_raw_result(handle, DPS310_REGISTER_TMP_B2, &handle->tmp_raw);
     if (status != DPS310_SUCCESS) goto errors;
-    // Wait for pressure to be ready.
-    status = _DPS310_wait_flag(i2c_address, DPS310_REGISTER_MEAS_CFG, 4, DPS310_ERROR_PRESSURE_TIMEOUT);
+    status = _DPS310_read_raw_result(handle, DPS310_REGISTER_PRS_B2, &handle->prs_raw);
     if (status != DPS310_SUCCESS) goto errors;
-    // Read pressure.
-    // B2.
-    status = _DPS310_read_register(i2c_address, DPS310_REGISTER_PRS_B2, &read_byte);
+#else
+    // Read PRS_B2 to TMP_B0 registers with auto-increment method (temperature result is kept by the sensor during pressure conversion).
+    status = _DPS310_read_registers(handle, DPS310_REGISTER_PRS_B2, result_registers, DPS310_NUMBER_OF_RESULT_REGISTERS);
     if (status != DPS310_SUCCESS) goto errors;
-    prs_raw |= (read_byte << 16);
-    // B1.
-    status = _DPS310_read_register(i2c_address, DPS310_REGISTER_PRS_B1, &read_byte);
+    // Decode both results.
+    status = _DPS310_decode_raw_result(&(result_registers[DPS310_REGISTER_PRS_B2]), &handle->prs_raw);
     if (status != DPS310_SUCCESS) goto errors;
-    prs_raw |= (read_byte << 8);
-    // B0.
-    status = _DPS310_read_register(i2c_address, DPS310_REGISTER_PRS_B0, &read_byte);
+    status = _DPS310_decode_raw_result(&(result_registers[DPS310_REGISTER_TMP_B2]), &handle->tmp_raw);
     if (status != DPS310_SUCCESS) goto errors;
-    prs_raw |= read_byte;
-    // Compute two complement.
-    math_status = MATH_two_complement_to_integer(prs_raw, 23, &dps310_ctx.prs_raw);
-    MATH_exit_error(DPS310_ERROR_BASE_MATH);
+#endif
+    // Temperature is up to date.
+    handle->tmp_raw_valid_flag = 1;
+    handle->temperature_age = 0;
 errors:
     return status;
 }
 
-/*** DPS310 functions ***/
+/*******************************************************************/
+static void _DPS310_update_temperature_measurement_flag(DPS310_handle_t* handle) {
+    // Measure temperature if there is no previous value or if it has been used for the configured number of measurements.
+    handle->temperature_measurement_flag = ((handle->tmp_raw_valid_flag == 0) || ((handle->temperature_age + 1) >= DPS310_CONFIGURATION(handle)->temperature_period)) ? 1 : 0;
+}
 
 /*******************************************************************/
-DPS310_status_t DPS310_init(void) {
+static DPS310_status_t _DPS310_wait_sensor_ready(DPS310_handle_t* handle) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
-    // Init hardware interface.
-    status = DPS310_HW_init();
+    // Check if the flag has already been seen since the last invalidation.
+    if (handle->sensor_ready_flag != 0) goto errors;
+    status = _DPS310_wait_flag(handle, DPS310_REGISTER_MEAS_CFG, 6, DPS310_INTERRUPT_NONE, 0, DPS310_ERROR_SENSOR_TIMEOUT);
     if (status != DPS310_SUCCESS) goto errors;
+    handle->sensor_ready_flag = 1;
 errors:
     return status;
 }
 
 /*******************************************************************/
-DPS310_status_t DPS310_de_init(void) {
+static DPS310_status_t _DPS310_compute_raw_temperature(DPS310_handle_t* handle) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
-    // Release hardware interface.
-    status = DPS310_HW_de_init();
+    // Wait for sensor to be ready.
+    status = _DPS310_wait_sensor_ready(handle);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Configure result shift and temperature oversampling.
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_TMP_CFG, DPS310_TMP_CFG(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+    // Trigger temperature measurement.
+    status = _DPS310_write_register(handle, DPS310_REGISTER_MEAS_CFG, 0x02);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Wait for temperature to be ready.
+    status = _DPS310_wait_flag(handle, DPS310_REGISTER_MEAS_CFG, 5, DPS310_INTERRUPT_TEMPERATURE, _DPS310_get_conversion_time_ms(DPS310_CONFIGURATION(handle)->temperature_oversampling), DPS310_ERROR_TEMPERATURE_TIMEOUT);
     if (status != DPS310_SUCCESS) goto errors;
 errors:
     return status;
 }
 
 /*******************************************************************/
-DPS310_status_t DPS310_get_pressure_temperature(uint8_t i2c_address, int32_t* pressure_pa, int32_t* temperature_degrees) {
+static DPS310_status_t _DPS310_compute_raw_pressure(DPS310_handle_t* handle) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
-    int64_t temp_s64 = 0;
-    int64_t last_term = 0;
-    // Check parameters.
-    if ((pressure_pa == NULL) || (temperature_degrees == NULL)) {
-        status = DPS310_ERROR_NULL_PARAMETER;
-        goto errors;
-    }
-    // Reset result.
-    dps310_ctx.tmp_raw = 0;
-    dps310_ctx.prs_raw = 0;
-    // Compute raw results.
-    status = _DPS310_compute_raw_temperature(i2c_address);
+    // Wait for sensor to be ready.
+    status = _DPS310_wait_sensor_ready(handle);
     if (status != DPS310_SUCCESS) goto errors;
-    status = _DPS310_compute_raw_pressure(i2c_address);
+    // Configure result shift, interrupts and pressure oversampling (temperature measurement may have been skipped).
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
     if (status != DPS310_SUCCESS) goto errors;
-    // Read calibration coefficients if needed.
-    if (dps310_ctx.coef_ready_flag == 0) {
-        status = _DPS310_read_calibration_coefficients(i2c_address);
-        if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_PRS_CFG, DPS310_PRS_CFG(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+    // Trigger pressure measurement.
+    status = _DPS310_write_register(handle, DPS310_REGISTER_MEAS_CFG, 0x01);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Wait for pressure to be ready.
+    status = _DPS310_wait_flag(handle, DPS310_REGISTER_MEAS_CFG, 4, DPS310_INTERRUPT_PRESSURE, _DPS310_get_conversion_time_ms(DPS310_CONFIGURATION(handle)->pressure_oversampling), DPS310_ERROR_PRESSURE_TIMEOUT);
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static int32_t _DPS310_scale_raw_result(int32_t raw_result, int64_t reciprocal, uint8_t shift) {
+    // Compute raw / k in Q24 format with rounding.
+    return ((int32_t) ((raw_result * reciprocal + (1LL << (shift - 1))) >> shift));
+}
+
+/*******************************************************************/
+static int32_t _DPS310_round_q24(int64_t value_q24, uint8_t shift) {
+    // Convert Q24 value to output unit with rounding.
+    return ((int32_t) ((value_q24 + (1LL << (shift - 1))) >> shift));
+}
+
+/*******************************************************************/
+static int64_t _DPS310_multiply_q24(int32_t x, int64_t y) {
+    // Compute (x * y) >> 24 without overflow by splitting y in 32-bits words.
+    int64_t y_high = (y >> 32);
+    uint32_t y_low = (uint32_t) y;
+    return (((x * y_high) * (1LL << (32 - DPS310_COMPENSATION_FRACTIONAL_BITS))) + ((x * ((int64_t) y_low)) >> DPS310_COMPENSATION_FRACTIONAL_BITS));
+}
+
+/*******************************************************************/
+static int64_t _DPS310_compute_pressure_q24(const DPS310_coefficients_t* coefficients, int32_t prs_scaled, int32_t tmp_scaled) {
+    // Local variables.
+    int64_t pressure_q24 = 0;
+    int64_t temp_s64 = 0;
+    // Compute pressure in Pa with Q24 format.
+    temp_s64 = (((int64_t) coefficients->c20) * DPS310_COMPENSATION_ONE) + (((int64_t) coefficients->c30) * prs_scaled);
+    temp_s64 = (((int64_t) coefficients->c10) * DPS310_COMPENSATION_ONE) + _DPS310_multiply_q24(prs_scaled, temp_s64);
+    pressure_q24 = (((int64_t) coefficients->c00) * DPS310_COMPENSATION_ONE) + _DPS310_multiply_q24(prs_scaled, temp_s64);
+    pressure_q24 += ((int64_t) coefficients->c01) * tmp_scaled;
+    temp_s64 = (((int64_t) coefficients->c11) * DPS310_COMPENSATION_ONE) + (((int64_t) coefficients->c21) * prs_scaled);
+    pressure_q24 += _DPS310_multiply_q24(tmp_scaled, _DPS310_multiply_q24(prs_scaled, temp_s64));
+    return pressure_q24;
+}
+
+/*******************************************************************/
+static int64_t _DPS310_compute_temperature_q24(const DPS310_coefficients_t* coefficients, int32_t tmp_scaled) {
+    // Compute temperature in degrees with Q24 format.
+    return ((((int64_t) coefficients->c0) * (DPS310_COMPENSATION_ONE / 2)) + (((int64_t) coefficients->c1) * tmp_scaled));
+}
+
+/*******************************************************************/
+static uint8_t _DPS310_get_pressure_shift(DPS310_pressure_unit_t pressure_unit) {
+    // Keep 6 fractional bits in Pa Q6 unit.
+    return ((pressure_unit == DPS310_PRESSURE_UNIT_PA_Q6) ? (DPS310_COMPENSATION_FRACTIONAL_BITS - 6) : DPS310_COMPENSATION_FRACTIONAL_BITS);
+}
+
+/*******************************************************************/
+static int64_t _DPS310_get_temperature_factor(DPS310_temperature_unit_t temperature_unit) {
+    // Scale degrees to the output unit.
+    return ((temperature_unit == DPS310_TEMPERATURE_UNIT_CENTI_DEGREES) ? 100 : 1);
+}
+
+/*******************************************************************/
+static int32_t _DPS310_compute_pressure(DPS310_coefficients_t* coefficients, const DPS310_configuration_t* configuration, int32_t prs_raw, int32_t tmp_raw) {
+    // Local variables.
+    int32_t prs_scaled = _DPS310_scale_raw_result(prs_raw, DPS310_SCALE_FACTOR_RECIPROCAL[configuration->pressure_oversampling], DPS310_SCALE_FACTOR_SHIFT[configuration->pressure_oversampling]);
+    int32_t tmp_scaled = _DPS310_scale_raw_result(tmp_raw, DPS310_SCALE_FACTOR_RECIPROCAL[configuration->temperature_oversampling], DPS310_SCALE_FACTOR_SHIFT[configuration->temperature_oversampling]);
+    // Convert to output unit.
+    return _DPS310_round_q24(_DPS310_compute_pressure_q24(coefficients, prs_scaled, tmp_scaled), _DPS310_get_pressure_shift(configuration->pressure_unit));
+}
+
+/*******************************************************************/
+static int32_t _DPS310_compute_temperature(DPS310_coefficients_t* coefficients, const DPS310_configuration_t* configuration, int32_t tmp_raw) {
+    // Local variables.
+    int32_t tmp_scaled = _DPS310_scale_raw_result(tmp_raw, DPS310_SCALE_FACTOR_RECIPROCAL[configuration->temperature_oversampling], DPS310_SCALE_FACTOR_SHIFT[configuration->temperature_oversampling]);
+    // Convert to output unit.
+    return _DPS310_round_q24((_DPS310_compute_temperature_q24(coefficients, tmp_scaled) * _DPS310_get_temperature_factor(configuration->temperature_unit)), DPS310_COMPENSATION_FRACTIONAL_BITS);
+}
+
+#ifdef DPS310_DRIVER_SAMPLE_BUFFER_SIZE
+/*******************************************************************/
+static uint8_t _DPS310_write_sample(DPS310_handle_t* handle, uint32_t write_index, uint32_t timestamp_us, int32_t pressure, int32_t temperature) {
+    // Local variables.
+    DPS310_sample_t* sample = NULL;
+    // Drop sample if the buffer is full.
+    if ((write_index - handle->sample_buffer_read_index) >= DPS310_DRIVER_SAMPLE_BUFFER_SIZE) {
+        handle->sample_buffer_overrun_count++;
+        return 0;
+    }
+    // Fill entry without publishing it.
+    sample = &(handle->sample_buffer[write_index & (DPS310_DRIVER_SAMPLE_BUFFER_SIZE - 1)]);
+    sample->timestamp_us = timestamp_us;
+    sample->pressure = pressure;
+    sample->temperature = temperature;
+    return 1;
+}
+
+/*******************************************************************/
+static void _DPS310_publish_samples(DPS310_handle_t* handle, uint32_t write_index) {
+    // Entries must be visible before the index.
+    DPS310_MEMORY_BARRIER();
+    handle->sample_buffer_write_index = write_index;
+}
+#endif
+
+/*******************************************************************/
+static DPS310_measurement_state_t _DPS310_get_pressure_state(DPS310_handle_t* handle) {
+    // Skip configuration write if the register is up to date.
+    return ((_DPS310_is_shadow_register_up_to_date(handle, DPS310_REGISTER_PRS_CFG, DPS310_PRS_CFG(handle)) == 0) ? DPS310_MEASUREMENT_STATE_PRESSURE_CONFIGURATION : DPS310_MEASUREMENT_STATE_PRESSURE_TRIGGER);
+}
+
+/*******************************************************************/
+static DPS310_measurement_state_t _DPS310_get_temperature_state(DPS310_handle_t* handle) {
+    // Skip temperature measurement if the previous value can be reused.
+    if (handle->temperature_measurement_flag == 0) {
+        return _DPS310_get_pressure_state(handle);
+    }
+    // Skip configuration write if the register is up to date.
+    return ((_DPS310_is_shadow_register_up_to_date(handle, DPS310_REGISTER_TMP_CFG, DPS310_TMP_CFG(handle)) == 0) ? DPS310_MEASUREMENT_STATE_TEMPERATURE_CONFIGURATION : DPS310_MEASUREMENT_STATE_TEMPERATURE_TRIGGER);
+}
+
+/*******************************************************************/
+static DPS310_measurement_state_t _DPS310_get_configuration_state(DPS310_handle_t* handle) {
+    // Skip configuration write if the register is up to date.
+    return ((_DPS310_is_shadow_register_up_to_date(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg) == 0) ? DPS310_MEASUREMENT_STATE_SHIFT_CONFIGURATION : _DPS310_get_temperature_state(handle));
+}
+
+/*******************************************************************/
+static uint32_t _DPS310_get_state_conversion_time_ms(DPS310_handle_t* handle) {
+    // Conversion started by the trigger of the current state (0 for other states).
+    if (handle->measurement_state == DPS310_MEASUREMENT_STATE_TEMPERATURE_WAIT) {
+        return _DPS310_get_conversion_time_ms(DPS310_CONFIGURATION(handle)->temperature_oversampling);
+    }
+    if (handle->measurement_state == DPS310_MEASUREMENT_STATE_PRESSURE_WAIT) {
+        return _DPS310_get_conversion_time_ms(DPS310_CONFIGURATION(handle)->pressure_oversampling);
+    }
+    return 0;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_poll_flag(DPS310_handle_t* handle, DPS310_register_t register_address, uint8_t bit_index, DPS310_interrupt_t interrupt, uint32_t conversion_time_ms, DPS310_status_t timeout_error, DPS310_measurement_state_t next_state) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t flag_value = 0;
+    uint32_t timestamp_us = _DPS310_get_timestamp_us();
+    uint32_t elapsed_us = 0;
+    // The wait starts at the first poll of the state, whatever the calls period.
+    if (handle->measurement_poll_count == 0) {
+        handle->measurement_wait_start_us = timestamp_us;
+    }
+    handle->measurement_poll_count++;
+    elapsed_us = (timestamp_us - handle->measurement_wait_start_us);
+    // Single register read (or interrupt status read if an interrupt occurred).
+    status = _DPS310_read_flag(handle, register_address, bit_index, interrupt, &flag_value);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Check flag.
+    if (flag_value != 0) {
+        handle->measurement_poll_count = 0;
+        handle->measurement_state = next_state;
+    }
+    else {
+        // Exit if timeout (also in interrupt mode, where a lost interrupt would otherwise block the state machine).
+        // Without timestamp source, the number of polls bounds the wait.
+        if ((elapsed_us > (_DPS310_get_flag_timeout_ms(conversion_time_ms) * 1000)) || ((elapsed_us == 0) && (handle->measurement_poll_count > DPS310_PROCESS_POLL_COUNT_MAX))) {
+            DPS310_STATISTICS_TIMEOUT(handle, timeout_error);
+            status = timeout_error;
+            goto errors;
+        }
+    }
+errors:
+    return status;
+}
+
+#ifdef DPS310_DRIVER_FILTER
+/*******************************************************************/
+static void _DPS310_reset_filter(DPS310_handle_t* handle) {
+    // Reset state.
+    handle->filter_median_count = 0;
+    handle->filter_median_index = 0;
+    handle->filter_initialized_flag = 0;
+    handle->filter_iir_state = 0;
+    handle->filter_kalman_state = 0;
+    handle->filter_kalman_covariance = 0;
+    handle->filter_kalman_gain = 0;
+    handle->filter_kalman_steady_flag = 0;
+}
+
+/*******************************************************************/
+static int32_t _DPS310_filter_median(DPS310_handle_t* handle, int32_t pressure) {
+    // Local variables.
+    int32_t window[DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX];
+    int32_t value = 0;
+    uint8_t idx = 0;
+    uint8_t jdx = 0;
+    // Store sample in history.
+    handle->filter_median_history[handle->filter_median_index] = pressure;
+    handle->filter_median_index = (uint8_t) ((handle->filter_median_index + 1) % (handle->filter_configuration.median_size));
+    if (handle->filter_median_count < handle->filter_configuration.median_size) {
+        handle->filter_median_count++;
+    }
+    // Insertion sort of the available samples.
+    for (idx = 0; idx < handle->filter_median_count; idx++) {
+        value = handle->filter_median_history[idx];
+        jdx = idx;
+        while ((jdx > 0) && (window[jdx - 1] > value)) {
+            window[jdx] = window[jdx - 1];
+            jdx--;
+        }
+        window[jdx] = value;
+    }
+    return window[handle->filter_median_count >> 1];
+}
+
+/*******************************************************************/
+static int32_t _DPS310_filter_sample(DPS310_handle_t* handle, int32_t pressure) {
+    // Local variables.
+    DPS310_filter_configuration_t* configuration = &(handle->filter_configuration);
+    int64_t sample = 0;
+    uint64_t covariance = 0;
+    uint32_t gain = 0;
+    // Spike rejection.
+    if ((configuration->stages_mask & DPS310_FILTER_STAGE_MEDIAN) != 0) {
+        pressure = _DPS310_filter_median(handle, pressure);
+    }
+    sample = ((int64_t) pressure * (1 << DPS310_FILTER_FRACTIONAL_BITS));
+    // Initialize recursive stages with the first sample.
+    if (handle->filter_initialized_flag == 0) {
+        handle->filter_iir_state = sample;
+        handle->filter_kalman_state = sample;
+        handle->filter_kalman_covariance = configuration->kalman_measurement_variance;
+        handle->filter_initialized_flag = 1;
+        return pressure;
+    }
+    // Low-pass.
+    if ((configuration->stages_mask & DPS310_FILTER_STAGE_IIR) != 0) {
+        handle->filter_iir_state += (((sample - handle->filter_iir_state) * (int64_t) configuration->iir_alpha) / DPS310_FILTER_GAIN_ONE);
+        sample = handle->filter_iir_state;
+    }
+    // Constant value model: predict covariance, then correct state.
+    if ((configuration->stages_mask & DPS310_FILTER_STAGE_KALMAN) != 0) {
+        // Covariance and gain do not depend on the samples: the gain is constant once the covariance is.
+        if (handle->filter_kalman_steady_flag == 0) {
+            covariance = (uint64_t) handle->filter_kalman_covariance + (uint64_t) configuration->kalman_process_variance;
+            handle->filter_kalman_gain = (uint32_t) ((covariance * DPS310_FILTER_GAIN_ONE) / (covariance + (uint64_t) configuration->kalman_measurement_variance + 1));
+            covariance = ((covariance * (uint64_t) (DPS310_FILTER_GAIN_ONE - handle->filter_kalman_gain)) / DPS310_FILTER_GAIN_ONE);
+            handle->filter_kalman_steady_flag = (covariance == handle->filter_kalman_covariance) ? 1 : 0;
+            handle->filter_kalman_covariance = (uint32_t) covariance;
+        }
+        gain = handle->filter_kalman_gain;
+        handle->filter_kalman_state += (((sample - handle->filter_kalman_state) * (int64_t) gain) / DPS310_FILTER_GAIN_ONE);
+        sample = handle->filter_kalman_state;
+    }
+    // Round to nearest to avoid a constant bias of the recursive stages.
+    sample += (sample < 0) ? (-(1 << (DPS310_FILTER_FRACTIONAL_BITS - 1))) : (1 << (DPS310_FILTER_FRACTIONAL_BITS - 1));
+    return (int32_t) (sample / (1 << DPS310_FILTER_FRACTIONAL_BITS));
+}
+#endif
+
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*******************************************************************/
+static DPS310_status_t _DPS310_read_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag, uint8_t raw_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t fifo_sts = 0;
+    int32_t raw = 0;
+    // Check parameters.
+    if ((handle == NULL) || (samples == NULL) || (number_of_samples == NULL) || (fifo_full_flag == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (handle->streaming_flag == 0) {
+        status = DPS310_ERROR_STREAMING_STOPPED;
+        goto errors;
+    }
+    // Reset output.
+    (*number_of_samples) = 0;
+    (*fifo_full_flag) = 0;
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    // In interrupt mode, the FIFO is only read after an interrupt.
+    if (handle->interrupt_mask != 0) {
+        status = _DPS310_update_interrupt_status(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+        if (handle->interrupt_status == 0) goto errors;
+        handle->interrupt_status = 0;
+    }
+#endif
+    // Read FIFO status before draining.
+    status = _DPS310_read_register(handle, DPS310_REGISTER_FIFO_STS, &fifo_sts);
+    if (status != DPS310_SUCCESS) goto errors;
+    (*fifo_full_flag) = ((fifo_sts >> 1) & 0x01);
+    // Exit if FIFO is empty.
+    if ((fifo_sts & 0x01) != 0) goto errors;
+    // Drain FIFO.
+    while ((*number_of_samples) < samples_size) {
+        // Each entry is read through the PRS_B2 to PRS_B0 registers.
+        status = _DPS310_read_raw_result(handle, DPS310_REGISTER_PRS_B2, &raw);
+        if (status != DPS310_SUCCESS) goto errors;
+        // Check empty marker.
+        if (raw == DPS310_FIFO_EMPTY_RAW_VALUE) break;
+        // LSB indicates the measurement type.
+        if ((raw & 0x01) != 0) {
+            samples[*number_of_samples].type = DPS310_FIFO_SAMPLE_TYPE_PRESSURE;
+            samples[*number_of_samples].value = (raw_flag != 0) ? raw : _DPS310_compute_pressure(&(handle->coefficients), DPS310_CONFIGURATION(handle), raw, handle->tmp_raw);
+        }
+        else {
+            // Update last temperature used for pressure compensation.
+            handle->tmp_raw = raw;
+            handle->tmp_raw_valid_flag = 1;
+            handle->temperature_age = 0;
+            samples[*number_of_samples].type = DPS310_FIFO_SAMPLE_TYPE_TEMPERATURE;
+            samples[*number_of_samples].value = (raw_flag != 0) ? raw : _DPS310_compute_temperature(&(handle->coefficients), DPS310_CONFIGURATION(handle), raw);
+        }
+        (*number_of_samples)++;
+    }
+errors:
+    return status;
+}
+#endif
+
+/*** DPS310 functions ***/
+
+/*******************************************************************/
+DPS310_status_t DPS310_init(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Init hardware interface.
+    status = DPS310_HW_init();
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_de_init(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Release hardware interface.
+    status = DPS310_HW_de_init();
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_init_handle(DPS310_handle_t* handle, uint8_t i2c_instance, uint8_t i2c_address) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    DPS310_configuration_t configuration;
+#endif
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+#ifdef DPS310_DRIVER_STATIC_CONFIGURATION
+    // Bus is fixed at compile time.
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+#else
+    // Bus.
+    handle->i2c_instance = i2c_instance;
+    handle->i2c_address = i2c_address;
+#endif
+    // Measurements.
+    handle->tmp_raw = 0;
+    handle->prs_raw = 0;
+    handle->wait_time_us = 0;
+    handle->tmp_raw_valid_flag = 0;
+    handle->temperature_measurement_flag = 0;
+    handle->temperature_age = 0;
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    // Interrupts.
+    handle->interrupt_mask = 0;
+    handle->interrupt_flag = 0;
+    handle->interrupt_status = 0;
+    handle->interrupt_callback = NULL;
+#endif
+    // Sensor registers state is unknown.
+    handle->sensor_ready_flag = 0;
+    handle->shadow_registers_valid_mask = 0;
+    // Calibration coefficients have to be read from this sensor (external temperature sensor until COEF_SRCE is read).
+    handle->coef_ready_flag = 0;
+    handle->tmp_coef_srce = 1;
+#ifdef DPS310_DRIVER_STATIC_CONFIGURATION
+    _DPS310_apply_configuration(handle, DPS310_CONFIGURATION(handle));
+#else
+    // Default configuration.
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.pressure_oversampling = DPS310_OVERSAMPLING_2;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.temperature_oversampling = DPS310_OVERSAMPLING_1;
+    configuration.pressure_unit = DPS310_PRESSURE_UNIT_PA;
+    configuration.temperature_unit = DPS310_TEMPERATURE_UNIT_DEGREES;
+    configuration.temperature_period = 1;
+    _DPS310_apply_configuration(handle, &configuration);
+#endif
+    // Modes.
+    handle->streaming_flag = 0;
+    handle->measurement_state = DPS310_MEASUREMENT_STATE_IDLE;
+    handle->measurement_poll_count = 0;
+    handle->measurement_completion_callback = NULL;
+#ifdef DPS310_DRIVER_SAMPLE_BUFFER_SIZE
+    handle->sample_buffer_write_index = 0;
+    handle->sample_buffer_read_index = 0;
+    handle->sample_buffer_overrun_count = 0;
+    handle->fifo_overrun_count = 0;
+#endif
+#ifdef DPS310_DRIVER_FILTER
+    // Filter is disabled by default.
+    handle->filter_configuration.stages_mask = DPS310_FILTER_STAGE_NONE;
+    handle->filter_configuration.median_size = DPS310_FILTER_MEDIAN_SIZE_DEFAULT;
+    handle->filter_configuration.iir_alpha = DPS310_FILTER_IIR_ALPHA_DEFAULT;
+    handle->filter_configuration.kalman_process_variance = DPS310_FILTER_KALMAN_Q_DEFAULT;
+    handle->filter_configuration.kalman_measurement_variance = DPS310_FILTER_KALMAN_R_DEFAULT;
+    _DPS310_reset_filter(handle);
+#endif
+#ifdef DPS310_DRIVER_STATISTICS
+    _DPS310_reset_statistics(handle);
+#endif
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_init_sensor(DPS310_handle_t* handle, uint8_t i2c_instance, uint8_t i2c_address, DPS310_configuration_t* configuration) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t probe_registers[DPS310_PROBE_BURST_SIZE_BYTES];
+    uint8_t meas_cfg = 0;
+    uint8_t idx = 0;
+    DPS310_STATISTICS_CALL_START
+    // Init context (statistics are reset, this call is the first one recorded).
+    status = DPS310_init_handle(handle, i2c_instance, i2c_address);
+    if (status != DPS310_SUCCESS) goto errors;
+    for (idx = 0; idx < DPS310_PROBE_BURST_SIZE_BYTES; idx++)
+        probe_registers[idx] = 0;
+    // Probe sensor, ready flags, coefficients and temperature source in a single burst.
+    status = _DPS310_read_registers(handle, DPS310_REGISTER_MEAS_CFG, probe_registers, DPS310_PROBE_BURST_SIZE_BYTES);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Fail fast if the device is not a DPS310.
+    if (probe_registers[DPS310_REGISTER_PRODUCT_ID - DPS310_REGISTER_MEAS_CFG] != DPS310_PRODUCT_ID) {
+        status = DPS310_ERROR_PRODUCT_ID;
+        goto errors;
+    }
+    meas_cfg = probe_registers[0];
+    // Coefficients of the burst are only valid once the sensor has loaded them (just after power-on otherwise).
+    if (((meas_cfg >> 7) & 0x01) != 0) {
+        status = _DPS310_load_coefficients(handle, &(probe_registers[DPS310_REGISTER_COEF_C0B - DPS310_REGISTER_MEAS_CFG]));
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    else {
+        status = _DPS310_read_calibration_coefficients(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    handle->sensor_ready_flag = ((meas_cfg >> 6) & 0x01);
+    status = _DPS310_wait_sensor_ready(handle);
+    if (status != DPS310_SUCCESS) goto errors;
+#ifdef DPS310_DRIVER_STATIC_CONFIGURATION
+    // Configuration is fixed at compile time.
+    UNUSED(configuration);
+#else
+    // Apply initial configuration.
+    if (configuration != NULL) {
+        status = DPS310_set_configuration(handle, configuration);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+#endif
+    // Write configuration registers now so that measurements only trigger conversions.
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_TMP_CFG, DPS310_TMP_CFG(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_PRS_CFG, DPS310_PRS_CFG(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_INIT_SENSOR);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_invalidate_cache(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Force registers write and ready flag check on next measurement (calibration coefficients are kept).
+    handle->sensor_ready_flag = 0;
+    handle->shadow_registers_valid_mask = 0;
+errors:
+    return status;
+}
+
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+/*******************************************************************/
+DPS310_status_t DPS310_set_configuration(DPS310_handle_t* handle, DPS310_configuration_t* configuration) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (configuration == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->pressure_rate >= DPS310_MEASUREMENT_RATE_LAST) || (configuration->temperature_rate >= DPS310_MEASUREMENT_RATE_LAST)) {
+        status = DPS310_ERROR_MEASUREMENT_RATE;
+        goto errors;
+    }
+    if ((configuration->pressure_oversampling >= DPS310_OVERSAMPLING_LAST) || (configuration->temperature_oversampling >= DPS310_OVERSAMPLING_LAST)) {
+        status = DPS310_ERROR_OVERSAMPLING;
+        goto errors;
+    }
+    if ((configuration->pressure_unit >= DPS310_PRESSURE_UNIT_LAST) || (configuration->temperature_unit >= DPS310_TEMPERATURE_UNIT_LAST)) {
+        status = DPS310_ERROR_UNIT;
+        goto errors;
+    }
+    // Configuration can't be changed during a measurement.
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    // Update handle.
+    _DPS310_apply_configuration(handle, configuration);
+    // Previous temperature can't be reused since it depends on the temperature oversampling.
+    handle->tmp_raw_valid_flag = 0;
+errors:
+    return status;
+}
+#endif
+
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+/*******************************************************************/
+DPS310_status_t DPS310_enable_interrupt(DPS310_handle_t* handle, uint8_t interrupt_mask, DPS310_interrupt_cb_t interrupt_callback) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t previous_interrupt_mask = 0;
+    DPS310_interrupt_cb_t previous_interrupt_callback = NULL;
+    uint8_t int_sts = 0;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((interrupt_mask == DPS310_INTERRUPT_NONE) || ((interrupt_mask & (uint8_t) ~DPS310_INTERRUPT_ALL) != 0)) {
+        status = DPS310_ERROR_INTERRUPT;
+        goto errors;
+    }
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    previous_interrupt_mask = handle->interrupt_mask;
+    previous_interrupt_callback = handle->interrupt_callback;
+    // Register interrupt handler first, the handle is left unchanged if the interrupt line is not available.
+    handle->interrupt_flag = 0;
+    handle->interrupt_status = 0;
+    status = DPS310_HW_enable_interrupt(DPS310_I2C_INSTANCE(handle), DPS310_I2C_ADDRESS(handle), &_DPS310_interrupt_handler, (void*) handle);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Update handle.
+    handle->interrupt_mask = interrupt_mask;
+    handle->interrupt_callback = interrupt_callback;
+    _DPS310_apply_configuration(handle, DPS310_CONFIGURATION(handle));
+    // Configure interrupt pin and clear pending interrupts.
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
+    if (status != DPS310_SUCCESS) goto errors_restore;
+    status = _DPS310_read_register(handle, DPS310_REGISTER_INT_STS, &int_sts);
+    if (status != DPS310_SUCCESS) goto errors_restore;
+    goto errors;
+errors_restore:
+    // Go back to the previous mode (CFG_REG is written again by the next measurement since it differs from the shadow copy).
+    handle->interrupt_mask = previous_interrupt_mask;
+    handle->interrupt_callback = previous_interrupt_callback;
+    _DPS310_apply_configuration(handle, DPS310_CONFIGURATION(handle));
+    if (previous_interrupt_mask == 0) {
+        DPS310_HW_disable_interrupt(DPS310_I2C_INSTANCE(handle), DPS310_I2C_ADDRESS(handle));
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_disable_interrupt(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    // Update handle.
+    handle->interrupt_mask = 0;
+    _DPS310_apply_configuration(handle, DPS310_CONFIGURATION(handle));
+    // Release interrupt pin.
+    status = DPS310_HW_disable_interrupt(DPS310_I2C_INSTANCE(handle), DPS310_I2C_ADDRESS(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
+    if (status != DPS310_SUCCESS) goto errors;
+    handle->interrupt_flag = 0;
+    handle->interrupt_status = 0;
+    handle->interrupt_callback = NULL;
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+DPS310_status_t DPS310_export_calibration(DPS310_handle_t* handle, uint8_t* calibration_blob) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    uint16_t crc = 0;
+    // Check parameters.
+    if ((handle == NULL) || (calibration_blob == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    // Read calibration coefficients if needed.
+    if (handle->coef_ready_flag == 0) {
+        status = _DPS310_read_calibration_coefficients(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    // Build blob.
+    calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_VERSION] = DPS310_CALIBRATION_BLOB_VERSION;
+    status = _DPS310_read_register(handle, DPS310_REGISTER_PRODUCT_ID, &(calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_PRODUCT_ID]));
+    if (status != DPS310_SUCCESS) goto errors;
+    calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_COEF_SRCE] = (uint8_t) (handle->tmp_coef_srce << 7);
+    _DPS310_encode_coefficients(&(handle->coefficients), &(calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_COEFFICIENTS]));
+    crc = _DPS310_compute_calibration_blob_crc(calibration_blob, DPS310_CALIBRATION_BLOB_INDEX_CRC);
+    calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_CRC] = (uint8_t) (crc >> 8);
+    calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_CRC + 1] = (uint8_t) (crc);
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_EXPORT_CALIBRATION);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_import_calibration(DPS310_handle_t* handle, uint8_t* calibration_blob, uint8_t* calibration_valid_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    uint8_t product_id = 0;
+    uint16_t crc = 0;
+    // Check parameters.
+    if ((handle == NULL) || (calibration_blob == NULL) || (calibration_valid_flag == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*calibration_valid_flag) = 0;
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    // Check version and integrity.
+    if (calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_VERSION] != DPS310_CALIBRATION_BLOB_VERSION) goto errors;
+    crc = _DPS310_compute_calibration_blob_crc(calibration_blob, DPS310_CALIBRATION_BLOB_INDEX_CRC);
+    if ((calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_CRC] != (uint8_t) (crc >> 8)) || (calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_CRC + 1] != (uint8_t) (crc))) goto errors;
+    // The blob is only matched by product ID (readable before the coefficients memory is loaded): the unit itself can not be identified.
+    status = _DPS310_read_register(handle, DPS310_REGISTER_PRODUCT_ID, &product_id);
+    if (status != DPS310_SUCCESS) goto errors;
+    if (product_id != calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_PRODUCT_ID]) goto errors;
+    // Use imported coefficients and temperature source (they will be read from the sensor on next measurement otherwise).
+    status = _DPS310_decode_coefficients(&(calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_COEFFICIENTS]), &(handle->coefficients));
+    if (status != DPS310_SUCCESS) goto errors;
+    handle->tmp_coef_srce = ((calibration_blob[DPS310_CALIBRATION_BLOB_INDEX_COEF_SRCE] >> 7) & 0x01);
+    _DPS310_apply_configuration(handle, DPS310_CONFIGURATION(handle));
+    handle->coef_ready_flag = 1;
+    (*calibration_valid_flag) = 1;
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_IMPORT_CALIBRATION);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_pressure_temperature(DPS310_handle_t* handle, int32_t* pressure, int32_t* temperature) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    // Check parameters.
+    if ((handle == NULL) || (pressure == NULL) || (temperature == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    // Reset result.
+    handle->wait_time_us = 0;
+    handle->prs_raw = 0;
+    // Read calibration coefficients if needed (they give the temperature sensor to configure).
+    if (handle->coef_ready_flag == 0) {
+        status = _DPS310_read_calibration_coefficients(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    // Compute raw results (temperature is skipped when the previous value can be reused).
+    _DPS310_update_temperature_measurement_flag(handle);
+    if (handle->temperature_measurement_flag != 0) {
+        status = _DPS310_compute_raw_temperature(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    status = _DPS310_compute_raw_pressure(handle);
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_read_raw_results(handle);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Compute pressure and temperature.
+    (*pressure) = _DPS310_compute_pressure(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->prs_raw, handle->tmp_raw);
+    (*temperature) = _DPS310_compute_temperature(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->tmp_raw);
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_GET_PRESSURE_TEMPERATURE);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_wait_time(DPS310_handle_t* handle, uint32_t* wait_time_us) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (wait_time_us == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*wait_time_us) = handle->wait_time_us;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_temperature_age(DPS310_handle_t* handle, uint32_t* temperature_age) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (temperature_age == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*temperature_age) = handle->temperature_age;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_raw_results(DPS310_handle_t* handle, int32_t* prs_raw, int32_t* tmp_raw) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (prs_raw == NULL) || (tmp_raw == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*prs_raw) = handle->prs_raw;
+    (*tmp_raw) = handle->tmp_raw;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_coefficients(DPS310_handle_t* handle, DPS310_coefficients_t* coefficients) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (coefficients == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Read calibration coefficients if needed.
+    if (handle->coef_ready_flag == 0) {
+        if (handle->streaming_flag != 0) {
+            status = DPS310_ERROR_STREAMING_RUNNING;
+            goto errors;
+        }
+        if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+            status = DPS310_ERROR_MEASUREMENT_RUNNING;
+            goto errors;
+        }
+        status = _DPS310_read_calibration_coefficients(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    (*coefficients) = handle->coefficients;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_start_measurement(DPS310_handle_t* handle, DPS310_measurement_completion_cb_t completion_callback) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check state.
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    // Init context.
+    handle->measurement_poll_count = 0;
+    handle->measurement_completion_callback = completion_callback;
+    handle->prs_raw = 0;
+    _DPS310_update_temperature_measurement_flag(handle);
+    // Read calibration coefficients first if needed, then skip the steps which are not required.
+    if (handle->coef_ready_flag == 0) {
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_COEFFICIENTS_WAIT;
+    }
+    else {
+        handle->measurement_state = (handle->sensor_ready_flag == 0) ? DPS310_MEASUREMENT_STATE_SENSOR_WAIT : _DPS310_get_configuration_state(handle);
+    }
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_START_MEASUREMENT);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_process(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Perform a single I2C step of the current state.
+    switch (handle->measurement_state) {
+    case DPS310_MEASUREMENT_STATE_IDLE:
+    case DPS310_MEASUREMENT_STATE_DONE:
+        // Nothing to do.
+        break;
+    case DPS310_MEASUREMENT_STATE_COEFFICIENTS_WAIT:
+        status = _DPS310_poll_flag(handle, DPS310_REGISTER_MEAS_CFG, 7, DPS310_INTERRUPT_NONE, 0, DPS310_ERROR_COEFFICIENTS_TIMEOUT, DPS310_MEASUREMENT_STATE_COEFFICIENTS_READ);
+        if (status != DPS310_SUCCESS) goto errors;
+        break;
+    case DPS310_MEASUREMENT_STATE_COEFFICIENTS_READ:
+        status = _DPS310_read_coefficients_registers(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = (handle->sensor_ready_flag == 0) ? DPS310_MEASUREMENT_STATE_SENSOR_WAIT : _DPS310_get_configuration_state(handle);
+        break;
+    case DPS310_MEASUREMENT_STATE_SENSOR_WAIT:
+        status = _DPS310_poll_flag(handle, DPS310_REGISTER_MEAS_CFG, 6, DPS310_INTERRUPT_NONE, 0, DPS310_ERROR_SENSOR_TIMEOUT, _DPS310_get_configuration_state(handle));
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->sensor_ready_flag = (handle->measurement_state != DPS310_MEASUREMENT_STATE_SENSOR_WAIT) ? 1 : 0;
+        break;
+    case DPS310_MEASUREMENT_STATE_SHIFT_CONFIGURATION:
+        status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = _DPS310_get_temperature_state(handle);
+        break;
+    case DPS310_MEASUREMENT_STATE_TEMPERATURE_CONFIGURATION:
+        status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_TMP_CFG, DPS310_TMP_CFG(handle));
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_TEMPERATURE_TRIGGER;
+        break;
+    case DPS310_MEASUREMENT_STATE_TEMPERATURE_TRIGGER:
+        status = _DPS310_write_register(handle, DPS310_REGISTER_MEAS_CFG, 0x02);
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_TEMPERATURE_WAIT;
+        break;
+    case DPS310_MEASUREMENT_STATE_TEMPERATURE_WAIT:
+        status = _DPS310_poll_flag(handle, DPS310_REGISTER_MEAS_CFG, 5, DPS310_INTERRUPT_TEMPERATURE, _DPS310_get_conversion_time_ms(DPS310_CONFIGURATION(handle)->temperature_oversampling), DPS310_ERROR_TEMPERATURE_TIMEOUT, _DPS310_get_pressure_state(handle));
+        if (status != DPS310_SUCCESS) goto errors;
+        break;
+    case DPS310_MEASUREMENT_STATE_PRESSURE_CONFIGURATION:
+        status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_PRS_CFG, DPS310_PRS_CFG(handle));
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_PRESSURE_TRIGGER;
+        break;
+    case DPS310_MEASUREMENT_STATE_PRESSURE_TRIGGER:
+        status = _DPS310_write_register(handle, DPS310_REGISTER_MEAS_CFG, 0x01);
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_PRESSURE_WAIT;
+        break;
+    case DPS310_MEASUREMENT_STATE_PRESSURE_WAIT:
+        status = _DPS310_poll_flag(handle, DPS310_REGISTER_MEAS_CFG, 4, DPS310_INTERRUPT_PRESSURE, _DPS310_get_conversion_time_ms(DPS310_CONFIGURATION(handle)->pressure_oversampling), DPS310_ERROR_PRESSURE_TIMEOUT, DPS310_MEASUREMENT_STATE_RESULTS_READ);
+        if (status != DPS310_SUCCESS) goto errors;
+        break;
+    case DPS310_MEASUREMENT_STATE_RESULTS_READ:
+        status = _DPS310_read_raw_results(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_DONE;
+#ifdef DPS310_DRIVER_SAMPLE_BUFFER_SIZE
+        // Feed samples buffer.
+        if (_DPS310_write_sample(handle, handle->sample_buffer_write_index, _DPS310_get_timestamp_us(), _DPS310_compute_pressure(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->prs_raw, handle->tmp_raw), _DPS310_compute_temperature(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->tmp_raw)) != 0) {
+            _DPS310_publish_samples(handle, (handle->sample_buffer_write_index + 1));
+        }
+#endif
+        // Notify completion.
+        if (handle->measurement_completion_callback != NULL) {
+            handle->measurement_completion_callback();
+        }
+        break;
+    default:
+        status = DPS310_ERROR_MEASUREMENT_STATE;
+        goto errors;
+    }
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_PROCESS);
+    // Abort measurement on error.
+    if ((status != DPS310_SUCCESS) && (handle != NULL)) {
+        handle->measurement_state = DPS310_MEASUREMENT_STATE_IDLE;
+    }
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_read_measurement(DPS310_handle_t* handle, int32_t* pressure, int32_t* temperature, uint8_t* measurement_done_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (pressure == NULL) || (temperature == NULL) || (measurement_done_flag == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*measurement_done_flag) = 0;
+    // Check state.
+    if (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE) goto errors;
+    // Compute pressure and temperature.
+    (*pressure) = _DPS310_compute_pressure(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->prs_raw, handle->tmp_raw);
+    (*temperature) = _DPS310_compute_temperature(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->tmp_raw);
+    (*measurement_done_flag) = 1;
+    // Release state machine.
+    handle->measurement_state = DPS310_MEASUREMENT_STATE_IDLE;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_pressure_temperature_multiple(DPS310_handle_t* handles, uint8_t number_of_sensors, DPS310_measurement_t* measurements) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_measurement_state_t previous_state = DPS310_MEASUREMENT_STATE_IDLE;
+    uint32_t group_time_ms = 0;
+    uint32_t remaining_time_ms = 0;
+    uint32_t delay_ms = 0;
+    uint8_t pending_count = 0;
+    uint8_t progress_flag = 0;
+    uint8_t measurement_done_flag = 0;
+    uint8_t idx = 0;
+    DPS310_STATISTICS_CALL_START
+    // Check parameters.
+    if ((handles == NULL) || (measurements == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Start all measurements.
+    for (idx = 0; idx < number_of_sensors; idx++) {
+        measurements[idx].pressure = 0;
+        measurements[idx].temperature = 0;
+        measurements[idx].timestamp_us = 0;
+        measurements[idx].status = DPS310_start_measurement(&(handles[idx]), NULL);
+        if (measurements[idx].status == DPS310_SUCCESS) {
+            pending_count++;
+        }
+    }
+    // Advance all state machines in turn, so that conversions overlap and results are collected in completion order.
+    // Until the result is dated, the timestamp holds the expected end of the running conversion (in ms of sleep since the start).
+    while (pending_count > 0) {
+        progress_flag = 0;
+        for (idx = 0; idx < number_of_sensors; idx++) {
+            // Skip failed and completed measurements, and conversions which can not be finished yet.
+            if ((measurements[idx].status != DPS310_SUCCESS) || (handles[idx].measurement_state == DPS310_MEASUREMENT_STATE_IDLE)) continue;
+            if (measurements[idx].timestamp_us > group_time_ms) continue;
+            previous_state = handles[idx].measurement_state;
+            measurements[idx].status = DPS310_process(&(handles[idx]));
+            if (measurements[idx].status != DPS310_SUCCESS) {
+                measurements[idx].timestamp_us = 0;
+                pending_count--;
+                continue;
+            }
+            if (handles[idx].measurement_state != previous_state) {
+                measurements[idx].timestamp_us = group_time_ms + _DPS310_get_state_conversion_time_ms(&(handles[idx]));
+                progress_flag = 1;
+            }
+            if (handles[idx].measurement_state != DPS310_MEASUREMENT_STATE_DONE) continue;
+            // Date and read results.
+            measurements[idx].timestamp_us = _DPS310_get_timestamp_us();
+            measurements[idx].status = DPS310_read_measurement(&(handles[idx]), &(measurements[idx].pressure), &(measurements[idx].temperature), &measurement_done_flag);
+            pending_count--;
+        }
+        // Sleep only when all remaining sensors are still converting: until the earliest expected end of conversion, then by polling period.
+        if ((pending_count > 0) && (progress_flag == 0)) {
+            delay_ms = 0;
+            for (idx = 0; idx < number_of_sensors; idx++) {
+                if ((measurements[idx].status != DPS310_SUCCESS) || (handles[idx].measurement_state == DPS310_MEASUREMENT_STATE_IDLE)) continue;
+                remaining_time_ms = (measurements[idx].timestamp_us > group_time_ms) ? (measurements[idx].timestamp_us - group_time_ms) : DPS310_DRIVER_POLLING_PERIOD_MS;
+                if ((delay_ms == 0) || (remaining_time_ms < delay_ms)) {
+                    delay_ms = remaining_time_ms;
+                }
+            }
+#ifdef DPS310_DRIVER_STATISTICS
+            // Every pending sensor is waited for.
+            for (idx = 0; idx < number_of_sensors; idx++) {
+                if ((measurements[idx].status != DPS310_SUCCESS) || (handles[idx].measurement_state == DPS310_MEASUREMENT_STATE_IDLE)) continue;
+                DPS310_STATISTICS_ADD(&(handles[idx]), delay_ms, delay_ms);
+            }
+#endif
+            status = DPS310_HW_delay_milliseconds(delay_ms);
+            if (status != DPS310_SUCCESS) goto errors;
+            group_time_ms += delay_ms;
+        }
+    }
+errors:
+#ifdef DPS310_DRIVER_STATISTICS
+    // Group latency seen by each sensor.
+    for (idx = 0; (handles != NULL) && (idx < number_of_sensors); idx++) {
+        DPS310_STATISTICS_CALL_END(&(handles[idx]), DPS310_STATISTICS_CALL_GET_PRESSURE_TEMPERATURE_MULTIPLE);
+    }
+#endif
+    return status;
+}
+
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*******************************************************************/
+DPS310_status_t DPS310_start_streaming(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    uint32_t measurement_time_us = 0;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Check that both measurements fit in one second with the current configuration.
+    measurement_time_us += (DPS310_CONVERSION_TIME_US[DPS310_CONFIGURATION(handle)->pressure_oversampling] << DPS310_CONFIGURATION(handle)->pressure_rate);
+    measurement_time_us += (DPS310_CONVERSION_TIME_US[DPS310_CONFIGURATION(handle)->temperature_oversampling] << DPS310_CONFIGURATION(handle)->temperature_rate);
+    if (measurement_time_us >= DPS310_BACKGROUND_MODE_BUDGET_US) {
+        status = DPS310_ERROR_MEASUREMENT_RATE;
+        goto errors;
+    }
+    if (handle->streaming_flag != 0) {
+        status = DPS310_ERROR_STREAMING_RUNNING;
+        goto errors;
+    }
+    if ((handle->measurement_state != DPS310_MEASUREMENT_STATE_IDLE) && (handle->measurement_state != DPS310_MEASUREMENT_STATE_DONE)) {
+        status = DPS310_ERROR_MEASUREMENT_RUNNING;
+        goto errors;
+    }
+    handle->wait_time_us = 0;
+    // Read calibration coefficients if needed.
+    if (handle->coef_ready_flag == 0) {
+        status = _DPS310_read_calibration_coefficients(handle);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    // Perform a first temperature measurement to compensate the pressure samples preceding the first temperature sample of the FIFO.
+    status = _DPS310_compute_raw_temperature(handle);
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_read_raw_result(handle, DPS310_REGISTER_TMP_B2, &handle->tmp_raw);
+    if (status != DPS310_SUCCESS) goto errors;
+    handle->tmp_raw_valid_flag = 1;
+    handle->temperature_age = 0;
+    // Flush FIFO.
+    status = _DPS310_write_register(handle, DPS310_REGISTER_RESET, 0x80);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Configure measurement rates and oversampling.
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_PRS_CFG, DPS310_PRS_CFG(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_TMP_CFG, DPS310_TMP_CFG(handle));
+    if (status != DPS310_SUCCESS) goto errors;
+    // Enable FIFO.
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, (uint8_t) (handle->cfg_reg | 0x02));
+    if (status != DPS310_SUCCESS) goto errors;
+    // Start continuous pressure and temperature measurements.
+    status = _DPS310_write_register(handle, DPS310_REGISTER_MEAS_CFG, 0x07);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Update flag.
+    handle->streaming_flag = 1;
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_START_STREAMING);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_stop_streaming(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Update flag.
+    handle->streaming_flag = 0;
+    // Go back to standby mode.
+    status = _DPS310_write_register(handle, DPS310_REGISTER_MEAS_CFG, 0x00);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Disable and flush FIFO.
+    status = _DPS310_write_configuration_register(handle, DPS310_REGISTER_CFG_REG, handle->cfg_reg);
+    if (status != DPS310_SUCCESS) goto errors;
+    status = _DPS310_write_register(handle, DPS310_REGISTER_RESET, 0x80);
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_STOP_STREAMING);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_read_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    // Drain and compensate.
+    status = _DPS310_read_fifo(handle, samples, samples_size, number_of_samples, fifo_full_flag, 0);
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_READ_FIFO);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_read_fifo_raw(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t samples_size, uint8_t* number_of_samples, uint8_t* fifo_full_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_STATISTICS_CALL_START
+    // Drain without compensation.
+    status = _DPS310_read_fifo(handle, samples, samples_size, number_of_samples, fifo_full_flag, 1);
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_READ_FIFO);
+    return status;
+}
+#endif
+
+#ifdef DPS310_DRIVER_SAMPLE_BUFFER_SIZE
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*******************************************************************/
+DPS310_status_t DPS310_acquire_fifo(DPS310_handle_t* handle, uint8_t* number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_fifo_sample_t fifo_samples[DPS310_FIFO_DEPTH];
+    uint8_t fifo_size = 0;
+    uint8_t fifo_full_flag = 0;
+    uint8_t number_of_pressure_samples = 0;
+    uint32_t write_index = 0;
+    uint32_t pressure_period_us = 0;
+    uint32_t timestamp_us = 0;
+    int32_t temperature = 0;
+    uint8_t idx = 0;
+    DPS310_STATISTICS_CALL_START
+    // Check parameters.
+    if (number_of_samples == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*number_of_samples) = 0;
+    // Temperature in use before the drain (the FIFO may start with pressure entries).
+    if (handle != NULL) {
+        temperature = _DPS310_compute_temperature(&(handle->coefficients), DPS310_CONFIGURATION(handle), handle->tmp_raw);
+    }
+    status = DPS310_read_fifo(handle, fifo_samples, DPS310_FIFO_DEPTH, &fifo_size, &fifo_full_flag);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Samples may have been lost by the sensor.
+    if (fifo_full_flag != 0) {
+        handle->fifo_overrun_count++;
+    }
+    // Count pressure entries to date them backwards from now.
+    for (idx = 0; idx < fifo_size; idx++) {
+        if (fifo_samples[idx].type == DPS310_FIFO_SAMPLE_TYPE_PRESSURE) {
+            number_of_pressure_samples++;
+        }
+    }
+    if (number_of_pressure_samples == 0) goto errors;
+    pressure_period_us = (1000000 >> DPS310_CONFIGURATION(handle)->pressure_rate);
+    timestamp_us = _DPS310_get_timestamp_us() - ((uint32_t) (number_of_pressure_samples - 1) * pressure_period_us);
+    // Fill buffer entries, then publish them at once.
+    write_index = handle->sample_buffer_write_index;
+    for (idx = 0; idx < fifo_size; idx++) {
+        if (fifo_samples[idx].type == DPS310_FIFO_SAMPLE_TYPE_TEMPERATURE) {
+            temperature = fifo_samples[idx].value;
+            continue;
+        }
+        if (_DPS310_write_sample(handle, write_index, timestamp_us, fifo_samples[idx].value, temperature) != 0) {
+            write_index++;
+            (*number_of_samples)++;
+        }
+        timestamp_us += pressure_period_us;
+    }
+    _DPS310_publish_samples(handle, write_index);
+errors:
+    DPS310_STATISTICS_CALL_END(handle, DPS310_STATISTICS_CALL_ACQUIRE_FIFO);
+    return status;
+}
+#endif
+
+/*******************************************************************/
+DPS310_status_t DPS310_pop_samples(DPS310_handle_t* handle, DPS310_sample_t* samples, uint32_t samples_size, uint32_t* number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint32_t read_index = 0;
+    uint32_t write_index = 0;
+    // Check parameters.
+    if ((handle == NULL) || (samples == NULL) || (number_of_samples == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*number_of_samples) = 0;
+    // Only the consumer writes the read index.
+    read_index = handle->sample_buffer_read_index;
+    write_index = handle->sample_buffer_write_index;
+    // Entries must be read after the index.
+    DPS310_MEMORY_BARRIER();
+    while ((read_index != write_index) && ((*number_of_samples) < samples_size)) {
+        samples[*number_of_samples] = handle->sample_buffer[read_index & (DPS310_DRIVER_SAMPLE_BUFFER_SIZE - 1)];
+        read_index++;
+        (*number_of_samples)++;
+    }
+    // Release entries.
+    DPS310_MEMORY_BARRIER();
+    handle->sample_buffer_read_index = read_index;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_get_overrun_counts(DPS310_handle_t* handle, uint32_t* sample_buffer_overrun_count, uint32_t* fifo_overrun_count) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (sample_buffer_overrun_count == NULL) || (fifo_overrun_count == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*sample_buffer_overrun_count) = handle->sample_buffer_overrun_count;
+    (*fifo_overrun_count) = handle->fifo_overrun_count;
+errors:
+    return status;
+}
+#endif
+
+#ifdef DPS310_DRIVER_FILTER
+/*******************************************************************/
+DPS310_status_t DPS310_set_filter_configuration(DPS310_handle_t* handle, DPS310_filter_configuration_t* filter_configuration) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((handle == NULL) || (filter_configuration == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (((filter_configuration->median_size & 0x01) == 0) || (filter_configuration->median_size > DPS310_DRIVER_FILTER_MEDIAN_SIZE_MAX)) {
+        status = DPS310_ERROR_MEDIAN_SIZE;
+        goto errors;
+    }
+    if (filter_configuration->iir_alpha > DPS310_FILTER_GAIN_ONE) {
+        status = DPS310_ERROR_FILTER_GAIN;
+        goto errors;
+    }
+    handle->filter_configuration = (*filter_configuration);
+    handle->filter_configuration.stages_mask &= DPS310_FILTER_STAGE_ALL;
+    _DPS310_reset_filter(handle);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_reset_filter(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    _DPS310_reset_filter(handle);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_filter_pressure(DPS310_handle_t* handle, int32_t* pressure, uint32_t number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((handle == NULL) || (pressure == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    for (idx = 0; idx < number_of_samples; idx++) {
+        pressure[idx] = _DPS310_filter_sample(handle, pressure[idx]);
+    }
+errors:
+    return status;
+}
+
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*******************************************************************/
+DPS310_status_t DPS310_filter_fifo(DPS310_handle_t* handle, DPS310_fifo_sample_t* samples, uint8_t number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((handle == NULL) || (samples == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    for (idx = 0; idx < number_of_samples; idx++) {
+        if (samples[idx].type != DPS310_FIFO_SAMPLE_TYPE_PRESSURE) continue;
+        samples[idx].value = _DPS310_filter_sample(handle, samples[idx].value);
+    }
+errors:
+    return status;
+}
+#endif
+#endif
+
+#ifdef DPS310_DRIVER_STATISTICS
+/*******************************************************************/
+DPS310_status_t DPS310_get_statistics(DPS310_handle_t* handle, DPS310_statistics_t* statistics) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((handle == NULL) || (statistics == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*statistics) = handle->statistics;
+    // Compute average latencies.
+    for (idx = 0; idx < DPS310_STATISTICS_CALL_LAST; idx++) {
+        if (statistics->calls[idx].count == 0) {
+            statistics->calls[idx].min_us = 0;
+            continue;
+        }
+        statistics->calls[idx].average_us = (uint32_t) (statistics->calls[idx].total_us / statistics->calls[idx].count);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_reset_statistics(DPS310_handle_t* handle) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    _DPS310_reset_statistics(handle);
+errors:
+    return status;
+}
+#endif
+
+/*******************************************************************/
+DPS310_status_t DPS310_compensate(DPS310_coefficients_t* coefficients, DPS310_configuration_t* configuration, int32_t* prs_raw, int32_t* tmp_raw, int32_t* pressure, int32_t* temperature, uint32_t number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_coefficients_t local_coefficients;
+    int64_t prs_reciprocal = 0;
+    int64_t tmp_reciprocal = 0;
+    int64_t temperature_factor = 0;
+    uint8_t prs_shift = 0;
+    uint8_t tmp_shift = 0;
+    uint8_t pressure_shift = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((coefficients == NULL) || (configuration == NULL) || (prs_raw == NULL) || (tmp_raw == NULL) || (pressure == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->pressure_oversampling >= DPS310_OVERSAMPLING_LAST) || (configuration->temperature_oversampling >= DPS310_OVERSAMPLING_LAST)) {
+        status = DPS310_ERROR_OVERSAMPLING;
+        goto errors;
+    }
+    if ((configuration->pressure_unit >= DPS310_PRESSURE_UNIT_LAST) || (configuration->temperature_unit >= DPS310_TEMPERATURE_UNIT_LAST)) {
+        status = DPS310_ERROR_UNIT;
+        goto errors;
+    }
+    // Copy coefficients and select scaling and units before the loops, so that the output stores can not alias them.
+    local_coefficients = (*coefficients);
+    prs_reciprocal = DPS310_SCALE_FACTOR_RECIPROCAL[configuration->pressure_oversampling];
+    prs_shift = DPS310_SCALE_FACTOR_SHIFT[configuration->pressure_oversampling];
+    tmp_reciprocal = DPS310_SCALE_FACTOR_RECIPROCAL[configuration->temperature_oversampling];
+    tmp_shift = DPS310_SCALE_FACTOR_SHIFT[configuration->temperature_oversampling];
+    pressure_shift = _DPS310_get_pressure_shift(configuration->pressure_unit);
+    temperature_factor = _DPS310_get_temperature_factor(configuration->temperature_unit);
+    // Branch-free iterations without any shared state.
+    for (idx = 0; idx < number_of_samples; idx++) {
+        pressure[idx] = _DPS310_round_q24(_DPS310_compute_pressure_q24(&local_coefficients, _DPS310_scale_raw_result(prs_raw[idx], prs_reciprocal, prs_shift), _DPS310_scale_raw_result(tmp_raw[idx], tmp_reciprocal, tmp_shift)), pressure_shift);
+    }
+    // Temperature output is optional.
+    if (temperature != NULL) {
+        for (idx = 0; idx < number_of_samples; idx++) {
+            temperature[idx] = _DPS310_round_q24((_DPS310_compute_temperature_q24(&local_coefficients, _DPS310_scale_raw_result(tmp_raw[idx], tmp_reciprocal, tmp_shift)) * temperature_factor), DPS310_COMPENSATION_FRACTIONAL_BITS);
+        }
     }
-    // Compute pressure in Pa.
-    temp_s64 = dps310_ctx.coef_c20 + (dps310_ctx.prs_raw * dps310_ctx.coef_c30) / DPS310_SAMPLING_FACTOR_KP;
-    temp_s64 = dps310_ctx.coef_c10 + (dps310_ctx.prs_raw * temp_s64) / DPS310_SAMPLING_FACTOR_KP;
-    temp_s64 = dps310_ctx.coef_c00 + (dps310_ctx.prs_raw * temp_s64) / DPS310_SAMPLING_FACTOR_KP;
-    temp_s64 += (dps310_ctx.tmp_raw * dps310_ctx.coef_c01) / DPS310_SAMPLING_FACTOR_KT;
-    last_term = dps310_ctx.coef_c11 + (dps310_ctx.prs_raw * dps310_ctx.coef_c21) / DPS310_SAMPLING_FACTOR_KP;
-    last_term = (dps310_ctx.prs_raw * last_term) / DPS310_SAMPLING_FACTOR_KP;
-    last_term = (dps310_ctx.tmp_raw * last_term) / DPS310_SAMPLING_FACTOR_KT;
-    temp_s64 += last_term;
-    (*pressure_pa) = (int32_t) temp_s64;
-    // Compute temperature in degrees.
-    temp_s64 = (dps310_ctx.coef_c0 >> 1) + (dps310_ctx.coef_c1 * dps310_ctx.tmp_raw) / DPS310_SAMPLING_FACTOR_KT;
-    (*temperature_degrees) = (int32_t) temp_s64;
 errors:
     return status;
 }
@@ -0,0 +1,263 @@
+/*
+ * dps310_altitude.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include "dps310_altitude.h"
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "types.h"
+
+#ifndef DPS310_DRIVER_DISABLE
+
+/*** DPS310 ALTITUDE local macros ***/
+
+// Standard atmosphere: h = (T0 / L) * (1 - (p / p0)^(R * L / (g * M))).
+#define DPS310_ALTITUDE_SCALE_HEIGHT_MM             44330769 // 288.15 K / 0.0065 K/m.
+// H / f(p0) is computed once per reference pressure in Q32 format (below 0.25 for any supported reference).
+#define DPS310_ALTITUDE_RECIPROCAL_SHIFT            32
+
+// Table of (p / 101325)^0.190263 in Q28 format, one entry every 512 Pa from DPS310_ALTITUDE_PRESSURE_MIN_PA.
+// Since (p / p0)^e = f(p) / f(p0), any reference pressure can use the same table.
+#define DPS310_ALTITUDE_TABLE_STEP_BITS             (9 + 6)
+#define DPS310_ALTITUDE_TABLE_STEP_MASK             ((1 << DPS310_ALTITUDE_TABLE_STEP_BITS) - 1)
+
+#define DPS310_ALTITUDE_PRESSURE_PA_TO_Q6_SHIFT     6
+
+// Default vertical speed filter gains (beta = alpha^2 / (2 - alpha)).
+#define DPS310_ALTITUDE_ALPHA_DEFAULT               8192 // 0.125
+#define DPS310_ALTITUDE_BETA_DEFAULT                546  // 0.0083
+
+// The filter is restarted when samples are too far apart, and ignores samples closer than any conversion of the sensor.
+#define DPS310_ALTITUDE_SAMPLE_GAP_MAX_US           2000000
+#define DPS310_ALTITUDE_SAMPLE_GAP_MIN_US           1000
+
+// Sample period in Q24 seconds: delta_us * (2^56 / 10^6) >> 32.
+#define DPS310_ALTITUDE_PERIOD_Q24_FACTOR           72057594038ULL
+#define DPS310_ALTITUDE_PERIOD_Q24_SHIFT            24
+// Speed correction: residual * beta / (65536 * delta_s) = (residual * beta * (15625 * 65536 / delta_us)) >> 26.
+// The reciprocal is computed once per sample period (below 2^20 for periods of at least 1 ms).
+#define DPS310_ALTITUDE_PERIOD_RECIPROCAL_NUMERATOR 1024000000
+#define DPS310_ALTITUDE_PERIOD_RECIPROCAL_SHIFT     26
+
+/*** DPS310 ALTITUDE local global variables ***/
+
+static const int32_t DPS310_ALTITUDE_RATIO_TABLE[] = {
+    212532891, 213225266, 213908204, 214581986, 215246882, 215903151,
+    216551038, 217190779, 217822600, 218446716, 219063334, 219672652,
+    220274862, 220870145, 221458678, 222040628, 222616158, 223185425,
+    223748579, 224305764, 224857120, 225402782, 225942880, 226477538,
+    227006877, 227531015, 228050064, 228564134, 229073329, 229577753,
+    230077503, 230572676, 231063364, 231549657, 232031642, 232509403,
+    232983022, 233452579, 233918150, 234379811, 234837634, 235291690,
+    235742046, 236188771, 236631929, 237071582, 237507793, 237940620,
+    238370122, 238796356, 239219376, 239639236, 240055989, 240469685,
+    240880375, 241288105, 241692925, 242094879, 242494012, 242890370,
+    243283993, 243674925, 244063205, 244448875, 244831972, 245212534,
+    245590600, 245966204, 246339384, 246710172, 247078605, 247444713,
+    247808531, 248170090, 248529421, 248886554, 249241519, 249594346,
+    249945063, 250293698, 250640278, 250984831, 251327382, 251667958,
+    252006584, 252343284, 252678082, 253011004, 253342071, 253671308,
+    253998735, 254324376, 254648253, 254970385, 255290795, 255609502,
+    255926528, 256241890, 256555610, 256867705, 257178194, 257487097,
+    257794430, 258100212, 258404460, 258707190, 259008421, 259308168,
+    259606448, 259903276, 260198668, 260492640, 260785207, 261076384,
+    261366185, 261654625, 261941718, 262227478, 262511919, 262795054,
+    263076897, 263357460, 263636758, 263914801, 264191604, 264467178,
+    264741535, 265014688, 265286647, 265557425, 265827033, 266095482,
+    266362784, 266628949, 266893988, 267157911, 267420730, 267682454,
+    267943093, 268202658, 268461158, 268718602, 268975002, 269230366,
+    269484702, 269738022, 269990333, 270241644, 270491965, 270741303,
+    270989668, 271237069, 271483512, 271729007, 271973562, 272217185,
+    272459883, 272701664, 272942537, 273182508, 273421585, 273659777,
+    273897089, 274133529, 274369104, 274603822, 274837689, 275070712,
+    275302898, 275534254, 275764786, 275994500, 276223404, 276451503,
+    276678804, 276905313, 277131036, 277355980, 277580150
+};
+
+/*** DPS310 ALTITUDE local functions ***/
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_ALTITUDE_convert_pressure(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, int32_t* pressure_q6) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Convert to 1/64 Pa.
+    switch (handle->pressure_unit) {
+    case DPS310_PRESSURE_UNIT_PA:
+        if ((pressure < DPS310_ALTITUDE_PRESSURE_MIN_PA) || (pressure >= DPS310_ALTITUDE_PRESSURE_MAX_PA)) {
+            status = DPS310_ERROR_PRESSURE_RANGE;
+            goto errors;
+        }
+        (*pressure_q6) = (pressure << DPS310_ALTITUDE_PRESSURE_PA_TO_Q6_SHIFT);
+        break;
+    case DPS310_PRESSURE_UNIT_PA_Q6:
+        if ((pressure < (DPS310_ALTITUDE_PRESSURE_MIN_PA << DPS310_ALTITUDE_PRESSURE_PA_TO_Q6_SHIFT)) || (pressure >= (DPS310_ALTITUDE_PRESSURE_MAX_PA << DPS310_ALTITUDE_PRESSURE_PA_TO_Q6_SHIFT))) {
+            status = DPS310_ERROR_PRESSURE_RANGE;
+            goto errors;
+        }
+        (*pressure_q6) = pressure;
+        break;
+    default:
+        status = DPS310_ERROR_UNIT;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static int32_t _DPS310_ALTITUDE_compute_ratio(int32_t pressure_q6) {
+    // Local variables.
+    uint32_t offset = (uint32_t) (pressure_q6 - (DPS310_ALTITUDE_PRESSURE_MIN_PA << DPS310_ALTITUDE_PRESSURE_PA_TO_Q6_SHIFT));
+    uint32_t idx = (offset >> DPS310_ALTITUDE_TABLE_STEP_BITS);
+    int64_t fraction = (int64_t) (offset & DPS310_ALTITUDE_TABLE_STEP_MASK);
+    int64_t first_difference = 0;
+    int64_t second_difference = 0;
+    // Quadratic interpolation on 3 consecutive entries (the function is increasing and concave).
+    first_difference = (int64_t) (DPS310_ALTITUDE_RATIO_TABLE[idx + 1] - DPS310_ALTITUDE_RATIO_TABLE[idx]);
+    second_difference = (int64_t) (2 * DPS310_ALTITUDE_RATIO_TABLE[idx + 1] - DPS310_ALTITUDE_RATIO_TABLE[idx] - DPS310_ALTITUDE_RATIO_TABLE[idx + 2]);
+    return (int32_t) (DPS310_ALTITUDE_RATIO_TABLE[idx] + ((first_difference * fraction) >> DPS310_ALTITUDE_TABLE_STEP_BITS) + (((second_difference * fraction * ((1 << DPS310_ALTITUDE_TABLE_STEP_BITS) - fraction))) >> (2 * DPS310_ALTITUDE_TABLE_STEP_BITS + 1)));
+}
+
+/*******************************************************************/
+static int32_t _DPS310_ALTITUDE_compute_altitude(DPS310_ALTITUDE_handle_t* handle, int32_t pressure_q6) {
+    // Local variables.
+    int64_t ratio_difference = (int64_t) (handle->reference_ratio - _DPS310_ALTITUDE_compute_ratio(pressure_q6));
+    // h = (f(p0) - f(p)) * (H / f(p0)) with rounding.
+    return (int32_t) ((ratio_difference * ((int64_t) handle->reference_reciprocal) + (1LL << (DPS310_ALTITUDE_RECIPROCAL_SHIFT - 1))) >> DPS310_ALTITUDE_RECIPROCAL_SHIFT);
+}
+
+/*** DPS310 ALTITUDE functions ***/
+
+/*******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_init_handle(DPS310_ALTITUDE_handle_t* handle, DPS310_pressure_unit_t pressure_unit, int32_t reference_pressure) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (pressure_unit >= DPS310_PRESSURE_UNIT_LAST) {
+        status = DPS310_ERROR_UNIT;
+        goto errors;
+    }
+    handle->pressure_unit = pressure_unit;
+    handle->alpha = DPS310_ALTITUDE_ALPHA_DEFAULT;
+    handle->beta = DPS310_ALTITUDE_BETA_DEFAULT;
+    status = DPS310_ALTITUDE_set_reference_pressure(handle, reference_pressure);
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_set_reference_pressure(DPS310_ALTITUDE_handle_t* handle, int32_t reference_pressure) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    int32_t reference_pressure_q6 = 0;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    status = _DPS310_ALTITUDE_convert_pressure(handle, reference_pressure, &reference_pressure_q6);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Reference ratio and its reciprocal are computed once.
+    handle->reference_pressure_q6 = reference_pressure_q6;
+    handle->reference_ratio = _DPS310_ALTITUDE_compute_ratio(reference_pressure_q6);
+    handle->reference_reciprocal = (uint32_t) ((((uint64_t) DPS310_ALTITUDE_SCALE_HEIGHT_MM) << DPS310_ALTITUDE_RECIPROCAL_SHIFT) / ((uint64_t) handle->reference_ratio));
+    handle->filter_initialized_flag = 0;
+    handle->period_us = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_set_vertical_speed_gains(DPS310_ALTITUDE_handle_t* handle, uint32_t alpha, uint32_t beta) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (handle == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    handle->alpha = (alpha > DPS310_ALTITUDE_GAIN_ONE) ? DPS310_ALTITUDE_GAIN_ONE : alpha;
+    handle->beta = (beta > DPS310_ALTITUDE_GAIN_ONE) ? DPS310_ALTITUDE_GAIN_ONE : beta;
+    handle->filter_initialized_flag = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_compute(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, int32_t* altitude_mm) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    int32_t pressure_q6 = 0;
+    // Check parameters.
+    if ((handle == NULL) || (altitude_mm == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    status = _DPS310_ALTITUDE_convert_pressure(handle, pressure, &pressure_q6);
+    if (status != DPS310_SUCCESS) goto errors;
+    (*altitude_mm) = _DPS310_ALTITUDE_compute_altitude(handle, pressure_q6);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_ALTITUDE_update(DPS310_ALTITUDE_handle_t* handle, int32_t pressure, uint32_t timestamp_us, int32_t* altitude_mm, int32_t* vertical_speed_mm_s) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    int32_t pressure_q6 = 0;
+    int32_t measured_altitude_mm = 0;
+    uint32_t delta_us = 0;
+    int64_t delta_q24 = 0;
+    int64_t predicted_altitude_mm = 0;
+    int64_t residual_mm = 0;
+    // Check parameters.
+    if ((handle == NULL) || (altitude_mm == NULL) || (vertical_speed_mm_s == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    status = _DPS310_ALTITUDE_convert_pressure(handle, pressure, &pressure_q6);
+    if (status != DPS310_SUCCESS) goto errors;
+    measured_altitude_mm = _DPS310_ALTITUDE_compute_altitude(handle, pressure_q6);
+    delta_us = (timestamp_us - handle->last_timestamp_us);
+    // Start from the first sample (or after a gap).
+    if ((handle->filter_initialized_flag == 0) || (delta_us > DPS310_ALTITUDE_SAMPLE_GAP_MAX_US)) {
+        handle->altitude_mm = measured_altitude_mm;
+        handle->vertical_speed_mm_s = 0;
+        handle->last_timestamp_us = timestamp_us;
+        handle->filter_initialized_flag = 1;
+        goto end;
+    }
+    // Ignore samples without significant elapsed time.
+    if (delta_us < DPS310_ALTITUDE_SAMPLE_GAP_MIN_US) goto end;
+    // Update reciprocal on sample period change only (constant for samples dated from the measurement rate).
+    if (delta_us != handle->period_us) {
+        handle->period_us = delta_us;
+        handle->period_reciprocal = ((DPS310_ALTITUDE_PERIOD_RECIPROCAL_NUMERATOR + (delta_us >> 1)) / delta_us);
+    }
+    // Predict altitude with the current speed.
+    delta_q24 = (int64_t) ((((uint64_t) delta_us) * DPS310_ALTITUDE_PERIOD_Q24_FACTOR) >> 32);
+    predicted_altitude_mm = (int64_t) handle->altitude_mm + (((int64_t) handle->vertical_speed_mm_s * delta_q24) >> DPS310_ALTITUDE_PERIOD_Q24_SHIFT);
+    residual_mm = ((int64_t) measured_altitude_mm - predicted_altitude_mm);
+    // Correct altitude and speed.
+    handle->altitude_mm = (int32_t) (predicted_altitude_mm + ((residual_mm * (int64_t) handle->alpha) / DPS310_ALTITUDE_GAIN_ONE));
+    handle->vertical_speed_mm_s += (int32_t) ((residual_mm * (int64_t) handle->beta * (int64_t) handle->period_reciprocal) >> DPS310_ALTITUDE_PERIOD_RECIPROCAL_SHIFT);
+    handle->last_timestamp_us = timestamp_us;
+end:
+    (*altitude_mm) = handle->altitude_mm;
+    (*vertical_speed_mm_s) = handle->vertical_speed_mm_s;
+errors:
+    return status;
+}
+
+#endif /* DPS310_DRIVER_DISABLE */
@@ -34,10 +34,11 @@ DPS310_status_t __attribute__((weak)) DPS310_HW_de_init(void) {
 }
 
 /*******************************************************************/
-DPS310_status_t __attribute__((weak)) DPS310_HW_i2c_write(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag) {
+DPS310_status_t __attribute__((weak)) DPS310_HW_i2c_write(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
     /* To be implemented */
+    UNUSED(i2c_instance);
     UNUSED(i2c_address);
     UNUSED(data);
     UNUSED(data_size_bytes);
@@ -46,16 +47,64 @@ DPS310_status_t __attribute__((weak)) DPS310_HW_i2c_write(uint8_t i2c_address, u
 }
 
 /*******************************************************************/
-DPS310_status_t __attribute__((weak)) DPS310_HW_i2c_read(uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes) {
+DPS310_status_t __attribute__((weak)) DPS310_HW_i2c_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes) {
     // Local variables.
     DPS310_status_t status = DPS310_SUCCESS;
     /* To be implemented */
+    UNUSED(i2c_instance);
     UNUSED(i2c_address);
     UNUSED(data);
     UNUSED(data_size_bytes);
     return status;
 }
 
+/*******************************************************************/
+DPS310_status_t __attribute__((weak)) DPS310_HW_i2c_write_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_data_size_bytes, uint8_t* rx_data, uint8_t rx_data_size_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Fallback to separate transfers.
+    status = DPS310_HW_i2c_write(i2c_instance, i2c_address, tx_data, tx_data_size_bytes, 1);
+    if (status != DPS310_SUCCESS) goto errors;
+    status = DPS310_HW_i2c_read(i2c_instance, i2c_address, rx_data, rx_data_size_bytes);
+    if (status != DPS310_SUCCESS) goto errors;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t __attribute__((weak)) DPS310_HW_enable_interrupt(uint8_t i2c_instance, uint8_t i2c_address, DPS310_HW_interrupt_cb_t interrupt_callback, void* context) {
+    // Local variables.
+    DPS310_status_t status = DPS310_ERROR_INTERRUPT;
+    /* To be implemented */
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+    UNUSED(interrupt_callback);
+    UNUSED(context);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t __attribute__((weak)) DPS310_HW_disable_interrupt(uint8_t i2c_instance, uint8_t i2c_address) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    /* To be implemented */
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t __attribute__((weak)) DPS310_HW_wait_interrupt(uint8_t i2c_instance, uint8_t i2c_address, volatile uint8_t* interrupt_flag, uint32_t timeout_ms) {
+    // Local variables.
+    DPS310_status_t status = DPS310_ERROR_INTERRUPT;
+    /* To be implemented */
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+    UNUSED(interrupt_flag);
+    UNUSED(timeout_ms);
+    return status;
+}
+
 /*******************************************************************/
 DPS310_status_t __attribute__((weak)) DPS310_HW_delay_milliseconds(uint32_t delay_ms) {
     // Local variables.
@@ -65,4 +114,13 @@ DPS310_status_t __attribute__((weak)) DPS310_HW_delay_milliseconds(uint32_t dela
     return status;
 }
 
+/*******************************************************************/
+DPS310_status_t __attribute__((weak)) DPS310_HW_get_timestamp_us(uint32_t* timestamp_us) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    /* To be implemented */
+    UNUSED(timestamp_us);
+    return status;
+}
+
 #endif /* DPS310_DRIVER_DISABLE */
@@ -0,0 +1,308 @@
+/*
+ * dps310_hw_linux.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+// Required for clock_nanosleep() with strict C dialects.
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include "dps310_hw_linux.h"
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "dps310_hw.h"
+#include "types.h"
+
+#if !(defined DPS310_DRIVER_DISABLE) && (defined DPS310_DRIVER_HW_LINUX)
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <stdio.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+/*** DPS310 HW LINUX local macros ***/
+
+#ifndef DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES
+#define DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES  8
+#endif
+
+#define DPS310_HW_LINUX_DEVICE_PATH_SIZE        32
+
+/*** DPS310 HW LINUX local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    int fd;
+    uint8_t open_flag;
+} DPS310_HW_LINUX_bus_t;
+
+/*******************************************************************/
+typedef struct {
+    DPS310_HW_LINUX_bus_t buses[DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES];
+    DPS310_HW_LINUX_statistics_t statistics;
+} DPS310_HW_LINUX_context_t;
+
+/*** DPS310 HW LINUX local global variables ***/
+
+static DPS310_HW_LINUX_context_t dps310_hw_linux_ctx;
+
+/*** DPS310 HW LINUX local functions ***/
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_HW_LINUX_get_fd(uint8_t i2c_instance, int* fd) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_LINUX_bus_t* bus = NULL;
+    // Check instance.
+    if (i2c_instance >= DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    bus = &(dps310_hw_linux_ctx.buses[i2c_instance]);
+    // Open bus on first use.
+    if (bus->open_flag == 0) {
+        dps310_hw_linux_ctx.statistics.open_count++;
+        bus->fd = DPS310_HW_LINUX_open(i2c_instance);
+        if (bus->fd < 0) {
+            status = DPS310_ERROR_BASE_I2C;
+            goto errors;
+        }
+        bus->open_flag = 1;
+    }
+    (*fd) = bus->fd;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_HW_LINUX_transfer(uint8_t i2c_instance, struct i2c_msg* messages, uint32_t number_of_messages) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    struct i2c_rdwr_ioctl_data transaction;
+    int fd = 0;
+    uint32_t idx = 0;
+    // Get bus.
+    status = _DPS310_HW_LINUX_get_fd(i2c_instance, &fd);
+    if (status != DPS310_SUCCESS) goto errors;
+    // All messages are sent in a single transaction with repeated starts.
+    transaction.msgs = messages;
+    transaction.nmsgs = number_of_messages;
+    dps310_hw_linux_ctx.statistics.ioctl_count++;
+    dps310_hw_linux_ctx.statistics.i2c_message_count += number_of_messages;
+    for (idx = 0; idx < number_of_messages; idx++) {
+        dps310_hw_linux_ctx.statistics.i2c_byte_count += messages[idx].len;
+    }
+    if (DPS310_HW_LINUX_ioctl(fd, I2C_RDWR, &transaction) < 0) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*** DPS310 HW LINUX functions ***/
+
+/*******************************************************************/
+int __attribute__((weak)) DPS310_HW_LINUX_open(uint8_t i2c_instance) {
+    // Local variables.
+    char device_path[DPS310_HW_LINUX_DEVICE_PATH_SIZE];
+    // Open character device.
+    snprintf(device_path, DPS310_HW_LINUX_DEVICE_PATH_SIZE, "/dev/i2c-%u", (unsigned int) i2c_instance);
+    return open(device_path, O_RDWR);
+}
+
+/*******************************************************************/
+int __attribute__((weak)) DPS310_HW_LINUX_ioctl(int fd, unsigned long request, void* argument) {
+    // System call.
+    return ioctl(fd, request, argument);
+}
+
+/*******************************************************************/
+int __attribute__((weak)) DPS310_HW_LINUX_close(int fd) {
+    // System call.
+    return close(fd);
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_LINUX_get_statistics(DPS310_HW_LINUX_statistics_t* statistics) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (statistics == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*statistics) = dps310_hw_linux_ctx.statistics;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_LINUX_reset_statistics(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Reset counters.
+    dps310_hw_linux_ctx.statistics.open_count = 0;
+    dps310_hw_linux_ctx.statistics.ioctl_count = 0;
+    dps310_hw_linux_ctx.statistics.i2c_message_count = 0;
+    dps310_hw_linux_ctx.statistics.i2c_byte_count = 0;
+    dps310_hw_linux_ctx.statistics.sleep_count = 0;
+    return status;
+}
+
+/*** DPS310 HW functions ***/
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_init(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Buses are opened on first use.
+    status = DPS310_HW_LINUX_reset_statistics();
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_de_init(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t idx = 0;
+    // Close all opened buses.
+    for (idx = 0; idx < DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES; idx++) {
+        if (dps310_hw_linux_ctx.buses[idx].open_flag == 0) continue;
+        if (DPS310_HW_LINUX_close(dps310_hw_linux_ctx.buses[idx].fd) < 0) {
+            status = DPS310_ERROR_BASE_I2C;
+        }
+        dps310_hw_linux_ctx.buses[idx].open_flag = 0;
+    }
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_i2c_write(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag) {
+    // Local variables.
+    struct i2c_msg message;
+    // Unused parameters (each transaction ends with a stop condition).
+    UNUSED(stop_flag);
+    // Single message.
+    message.addr = i2c_address;
+    message.flags = 0;
+    message.len = data_size_bytes;
+    message.buf = data;
+    return _DPS310_HW_LINUX_transfer(i2c_instance, &message, 1);
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    struct i2c_msg message;
+    // Single message.
+    message.addr = i2c_address;
+    message.flags = I2C_M_RD;
+    message.len = data_size_bytes;
+    message.buf = data;
+    return _DPS310_HW_LINUX_transfer(i2c_instance, &message, 1);
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_i2c_write_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_data_size_bytes, uint8_t* rx_data, uint8_t rx_data_size_bytes) {
+    // Local variables.
+    struct i2c_msg messages[2];
+    // Register address write and data read with repeated start in a single system call.
+    messages[0].addr = i2c_address;
+    messages[0].flags = 0;
+    messages[0].len = tx_data_size_bytes;
+    messages[0].buf = tx_data;
+    messages[1].addr = i2c_address;
+    messages[1].flags = I2C_M_RD;
+    messages[1].len = rx_data_size_bytes;
+    messages[1].buf = rx_data;
+    return _DPS310_HW_LINUX_transfer(i2c_instance, messages, 2);
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_enable_interrupt(uint8_t i2c_instance, uint8_t i2c_address, DPS310_HW_interrupt_cb_t interrupt_callback, void* context) {
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+    UNUSED(interrupt_callback);
+    UNUSED(context);
+    // The SDO/INT pin is not reachable through the I2C character device, flags must be polled.
+    return DPS310_ERROR_INTERRUPT;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_disable_interrupt(uint8_t i2c_instance, uint8_t i2c_address) {
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+    // Nothing to release since interrupts can not be enabled.
+    return DPS310_SUCCESS;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_wait_interrupt(uint8_t i2c_instance, uint8_t i2c_address, volatile uint8_t* interrupt_flag, uint32_t timeout_ms) {
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    UNUSED(i2c_address);
+    UNUSED(interrupt_flag);
+    UNUSED(timeout_ms);
+    // Interrupts can not be enabled.
+    return DPS310_ERROR_INTERRUPT;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_delay_milliseconds(uint32_t delay_ms) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    struct timespec deadline;
+    int result = 0;
+    // Absolute deadline so that signals do not extend the delay.
+    if (clock_gettime(CLOCK_MONOTONIC, &deadline) != 0) {
+        status = DPS310_ERROR_BASE_DELAY;
+        goto errors;
+    }
+    deadline.tv_sec += (time_t) (delay_ms / 1000);
+    deadline.tv_nsec += (long) ((delay_ms % 1000) * 1000000);
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000;
+    }
+    dps310_hw_linux_ctx.statistics.sleep_count++;
+    do {
+        result = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL);
+    }
+    while (result == EINTR);
+    if (result != 0) {
+        status = DPS310_ERROR_BASE_DELAY;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_get_timestamp_us(uint32_t* timestamp_us) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    struct timespec now;
+    // Monotonic clock.
+    if (clock_gettime(CLOCK_MONOTONIC, &now) != 0) {
+        status = DPS310_ERROR_BASE_DELAY;
+        goto errors;
+    }
+    (*timestamp_us) = (uint32_t) (((uint64_t) now.tv_sec * 1000000) + ((uint64_t) now.tv_nsec / 1000));
+errors:
+    return status;
+}
+
+#endif /* DPS310_DRIVER_DISABLE and DPS310_DRIVER_HW_LINUX */
@@ -0,0 +1,635 @@
+/*
+ * dps310_hw_simulator.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include "dps310_hw_simulator.h"
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "dps310_hw.h"
+#include "types.h"
+
+#if !(defined DPS310_DRIVER_DISABLE) && (defined DPS310_DRIVER_HW_SIMULATOR)
+
+/*** DPS310 HW SIMULATOR local macros ***/
+
+#ifndef DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ
+#define DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ     400000
+#endif
+
+#define DPS310_HW_SIMULATOR_NUMBER_OF_REGISTERS         0x29
+#define DPS310_HW_SIMULATOR_FIFO_DEPTH                  32
+
+#define DPS310_HW_SIMULATOR_SENSOR_READY_TIME_US        12000
+#define DPS310_HW_SIMULATOR_COEFFICIENTS_READY_TIME_US  40000
+
+// Start, stop and acknowledge bits are included.
+#define DPS310_HW_SIMULATOR_I2C_BITS_PER_BYTE           9
+#define DPS310_HW_SIMULATOR_I2C_BITS_PER_TRANSACTION    2
+
+#define DPS310_HW_SIMULATOR_FIFO_EMPTY_RAW_VALUE        0x800000
+
+// Host wake-up resolution while waiting for an interrupt.
+#define DPS310_HW_SIMULATOR_WAIT_STEP_US                100
+
+/*** DPS310 HW SIMULATOR local structures ***/
+
+/*******************************************************************/
+typedef enum {
+    DPS310_HW_SIMULATOR_REGISTER_PRS_B2 = 0x00,
+    DPS310_HW_SIMULATOR_REGISTER_PRS_B0 = 0x02,
+    DPS310_HW_SIMULATOR_REGISTER_TMP_B2 = 0x03,
+    DPS310_HW_SIMULATOR_REGISTER_TMP_B0 = 0x05,
+    DPS310_HW_SIMULATOR_REGISTER_PRS_CFG = 0x06,
+    DPS310_HW_SIMULATOR_REGISTER_TMP_CFG = 0x07,
+    DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG = 0x08,
+    DPS310_HW_SIMULATOR_REGISTER_CFG_REG = 0x09,
+    DPS310_HW_SIMULATOR_REGISTER_INT_STS = 0x0A,
+    DPS310_HW_SIMULATOR_REGISTER_FIFO_STS = 0x0B,
+    DPS310_HW_SIMULATOR_REGISTER_RESET = 0x0C,
+    DPS310_HW_SIMULATOR_REGISTER_PRODUCT_ID = 0x0D,
+    DPS310_HW_SIMULATOR_REGISTER_COEF_C0B = 0x10,
+    DPS310_HW_SIMULATOR_REGISTER_COEF_SRCE = 0x28
+} DPS310_HW_SIMULATOR_register_t;
+
+/*******************************************************************/
+typedef enum {
+    DPS310_HW_SIMULATOR_COMMAND_NONE = 0x00,
+    DPS310_HW_SIMULATOR_COMMAND_PRESSURE = 0x01,
+    DPS310_HW_SIMULATOR_COMMAND_TEMPERATURE = 0x02
+} DPS310_HW_SIMULATOR_command_t;
+
+/*******************************************************************/
+typedef struct {
+    uint8_t registers[DPS310_HW_SIMULATOR_NUMBER_OF_REGISTERS];
+    uint8_t register_pointer;
+    int32_t prs_raw;
+    int32_t tmp_raw;
+    uint32_t reset_time_us;
+    DPS310_HW_SIMULATOR_command_t command;
+    uint32_t command_end_time_us;
+    uint32_t next_prs_time_us;
+    uint32_t next_tmp_time_us;
+    int32_t fifo[DPS310_HW_SIMULATOR_FIFO_DEPTH];
+    uint8_t fifo_count;
+    DPS310_HW_interrupt_cb_t interrupt_callback;
+    void* interrupt_context;
+} DPS310_HW_SIMULATOR_sensor_t;
+
+/*******************************************************************/
+typedef struct {
+    DPS310_HW_SIMULATOR_sensor_t sensors[DPS310_HW_SIMULATOR_NUMBER_OF_SENSORS];
+    uint32_t time_us;
+    uint8_t write_read_split_flag;
+    uint8_t interrupt_lines_flag;
+    DPS310_HW_SIMULATOR_statistics_t statistics;
+} DPS310_HW_SIMULATOR_context_t;
+
+/*** DPS310 HW SIMULATOR local global variables ***/
+
+static const uint32_t DPS310_HW_SIMULATOR_CONVERSION_TIME_US[DPS310_OVERSAMPLING_LAST] = { 3600, 5200, 8400, 14800, 27600, 53200, 104400, 206800 };
+// Typical coefficients registers (COEF_C0B to COEF_C30A: c0=204, c1=-261, c00=80469, c10=-54769, c01=-2870, c11=1141, c20=-10071, c21=188, c30=-1412)
+// and raw results (about 101 kPa and 25 degrees).
+static const uint8_t DPS310_HW_SIMULATOR_DEFAULT_COEFFICIENTS_REGISTERS[DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES] = { 0x0C, 0xCE, 0xFB, 0x13, 0xA5, 0x5F, 0x2A, 0x0F, 0xF4, 0xCA, 0x04, 0x75, 0xD8, 0xA9, 0x00, 0xBC, 0xFA, 0x7C };
+static const int32_t DPS310_HW_SIMULATOR_DEFAULT_PRS_RAW = -600000;
+static const int32_t DPS310_HW_SIMULATOR_DEFAULT_TMP_RAW = 154700;
+
+static DPS310_HW_SIMULATOR_context_t dps310_hw_simulator_ctx;
+
+/*** DPS310 HW SIMULATOR local functions ***/
+
+/*******************************************************************/
+static uint8_t _DPS310_HW_SIMULATOR_is_time_reached(uint32_t time_us) {
+    // Wrap-around safe comparison.
+    return (((int32_t) (dps310_hw_simulator_ctx.time_us - time_us)) >= 0) ? 1 : 0;
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_write_result(DPS310_HW_SIMULATOR_sensor_t* sensor, DPS310_HW_SIMULATOR_register_t b2_register_address, int32_t raw_result) {
+    // Local variables.
+    uint32_t raw = ((uint32_t) raw_result) & 0x00FFFFFF;
+    // Update B2, B1 and B0 registers.
+    sensor->registers[b2_register_address + 0] = (uint8_t) (raw >> 16);
+    sensor->registers[b2_register_address + 1] = (uint8_t) (raw >> 8);
+    sensor->registers[b2_register_address + 2] = (uint8_t) (raw);
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_power_on(DPS310_HW_SIMULATOR_sensor_t* sensor) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Reset all registers except calibration coefficients.
+    for (idx = 0; idx < DPS310_HW_SIMULATOR_REGISTER_COEF_C0B; idx++) {
+        sensor->registers[idx] = 0x00;
+    }
+    sensor->registers[DPS310_HW_SIMULATOR_REGISTER_PRODUCT_ID] = 0x10;
+    sensor->registers[DPS310_HW_SIMULATOR_REGISTER_COEF_SRCE] = 0x80;
+    sensor->register_pointer = 0;
+    sensor->reset_time_us = dps310_hw_simulator_ctx.time_us;
+    sensor->command = DPS310_HW_SIMULATOR_COMMAND_NONE;
+    sensor->fifo_count = 0;
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_write_coefficients_registers(DPS310_HW_SIMULATOR_sensor_t* sensor, const uint8_t* coefficients_registers) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Registers are written as given (the encoding is not computed by the simulator).
+    for (idx = 0; idx < DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES; idx++) {
+        sensor->registers[DPS310_HW_SIMULATOR_REGISTER_COEF_C0B + idx] = coefficients_registers[idx];
+    }
+}
+
+/*******************************************************************/
+static DPS310_HW_SIMULATOR_sensor_t* _DPS310_HW_SIMULATOR_get_sensor(uint8_t i2c_address) {
+    // Local variables.
+    uint8_t sensor_index = (uint8_t) (i2c_address - DPS310_HW_SIMULATOR_I2C_ADDRESS_FIRST);
+    // Check address.
+    if ((i2c_address < DPS310_HW_SIMULATOR_I2C_ADDRESS_FIRST) || (sensor_index >= DPS310_HW_SIMULATOR_NUMBER_OF_SENSORS)) {
+        return NULL;
+    }
+    return &(dps310_hw_simulator_ctx.sensors[sensor_index]);
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_set_interrupt(DPS310_HW_SIMULATOR_sensor_t* sensor, uint8_t interrupt_bit_index) {
+    // Check enable bit.
+    if ((sensor->registers[DPS310_HW_SIMULATOR_REGISTER_CFG_REG] & (0b1 << (interrupt_bit_index + 4))) == 0) return;
+    sensor->registers[DPS310_HW_SIMULATOR_REGISTER_INT_STS] |= (uint8_t) (0b1 << interrupt_bit_index);
+    // Raise interrupt line.
+    if (sensor->interrupt_callback != NULL) {
+        sensor->interrupt_callback(sensor->interrupt_context);
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_store_sample(DPS310_HW_SIMULATOR_sensor_t* sensor, DPS310_HW_SIMULATOR_command_t sample_type) {
+    // FIFO mode.
+    if ((sensor->registers[DPS310_HW_SIMULATOR_REGISTER_CFG_REG] & 0x02) != 0) {
+        // Samples are lost when the FIFO is full.
+        if (sensor->fifo_count < DPS310_HW_SIMULATOR_FIFO_DEPTH) {
+            // LSB indicates the measurement type.
+            sensor->fifo[sensor->fifo_count] = (sample_type == DPS310_HW_SIMULATOR_COMMAND_PRESSURE) ? (sensor->prs_raw | 0x01) : (sensor->tmp_raw & (int32_t) ~0x01);
+            sensor->fifo_count++;
+            if (sensor->fifo_count >= DPS310_HW_SIMULATOR_FIFO_DEPTH) {
+                _DPS310_HW_SIMULATOR_set_interrupt(sensor, 2);
+            }
+        }
+        return;
+    }
+    // Result registers.
+    if (sample_type == DPS310_HW_SIMULATOR_COMMAND_PRESSURE) {
+        _DPS310_HW_SIMULATOR_write_result(sensor, DPS310_HW_SIMULATOR_REGISTER_PRS_B2, sensor->prs_raw);
+        sensor->registers[DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG] |= (0b1 << 4);
+        _DPS310_HW_SIMULATOR_set_interrupt(sensor, 0);
+    }
+    else {
+        _DPS310_HW_SIMULATOR_write_result(sensor, DPS310_HW_SIMULATOR_REGISTER_TMP_B2, sensor->tmp_raw);
+        sensor->registers[DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG] |= (0b1 << 5);
+        _DPS310_HW_SIMULATOR_set_interrupt(sensor, 1);
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_update(DPS310_HW_SIMULATOR_sensor_t* sensor) {
+    // Local variables.
+    uint8_t* meas_cfg = &(sensor->registers[DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG]);
+    uint8_t meas_ctrl = ((*meas_cfg) & 0x07);
+    // Initialization flags.
+    if (_DPS310_HW_SIMULATOR_is_time_reached(sensor->reset_time_us + DPS310_HW_SIMULATOR_SENSOR_READY_TIME_US) != 0) {
+        (*meas_cfg) |= (0b1 << 6);
+    }
+    if (_DPS310_HW_SIMULATOR_is_time_reached(sensor->reset_time_us + DPS310_HW_SIMULATOR_COEFFICIENTS_READY_TIME_US) != 0) {
+        (*meas_cfg) |= (0b1 << 7);
+    }
+    // Command mode.
+    if ((sensor->command != DPS310_HW_SIMULATOR_COMMAND_NONE) && (_DPS310_HW_SIMULATOR_is_time_reached(sensor->command_end_time_us) != 0)) {
+        _DPS310_HW_SIMULATOR_store_sample(sensor, sensor->command);
+        sensor->command = DPS310_HW_SIMULATOR_COMMAND_NONE;
+        // Go back to idle.
+        (*meas_cfg) &= 0xF8;
+    }
+    // Background mode.
+    if ((meas_ctrl & 0x04) == 0) return;
+    if ((meas_ctrl & 0x01) != 0) {
+        while (_DPS310_HW_SIMULATOR_is_time_reached(sensor->next_prs_time_us) != 0) {
+            _DPS310_HW_SIMULATOR_store_sample(sensor, DPS310_HW_SIMULATOR_COMMAND_PRESSURE);
+            sensor->next_prs_time_us += (1000000 >> ((sensor->registers[DPS310_HW_SIMULATOR_REGISTER_PRS_CFG] >> 4) & 0x07));
+        }
+    }
+    if ((meas_ctrl & 0x02) != 0) {
+        while (_DPS310_HW_SIMULATOR_is_time_reached(sensor->next_tmp_time_us) != 0) {
+            _DPS310_HW_SIMULATOR_store_sample(sensor, DPS310_HW_SIMULATOR_COMMAND_TEMPERATURE);
+            sensor->next_tmp_time_us += (1000000 >> ((sensor->registers[DPS310_HW_SIMULATOR_REGISTER_TMP_CFG] >> 4) & 0x07));
+        }
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_sleep(uint32_t duration_us) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Simulated time only.
+    dps310_hw_simulator_ctx.time_us += duration_us;
+    dps310_hw_simulator_ctx.statistics.time_us += duration_us;
+    // Sensors with an interrupt line keep running while the host sleeps.
+    for (idx = 0; idx < DPS310_HW_SIMULATOR_NUMBER_OF_SENSORS; idx++) {
+        if (dps310_hw_simulator_ctx.sensors[idx].interrupt_callback != NULL) {
+            _DPS310_HW_SIMULATOR_update(&(dps310_hw_simulator_ctx.sensors[idx]));
+        }
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_write_register(DPS310_HW_SIMULATOR_sensor_t* sensor, uint8_t register_address, uint8_t value) {
+    // Local variables.
+    uint32_t prs_conversion_time_us = DPS310_HW_SIMULATOR_CONVERSION_TIME_US[sensor->registers[DPS310_HW_SIMULATOR_REGISTER_PRS_CFG] & 0x07];
+    uint32_t tmp_conversion_time_us = DPS310_HW_SIMULATOR_CONVERSION_TIME_US[sensor->registers[DPS310_HW_SIMULATOR_REGISTER_TMP_CFG] & 0x07];
+    // Check register.
+    switch (register_address) {
+    case DPS310_HW_SIMULATOR_REGISTER_PRS_CFG:
+    case DPS310_HW_SIMULATOR_REGISTER_TMP_CFG:
+    case DPS310_HW_SIMULATOR_REGISTER_CFG_REG:
+        sensor->registers[register_address] = value;
+        break;
+    case DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG:
+        // Only the measurement control field is writable.
+        sensor->registers[register_address] = (uint8_t) ((sensor->registers[register_address] & 0xF0) | (value & 0x07));
+        sensor->command = DPS310_HW_SIMULATOR_COMMAND_NONE;
+        if ((value & 0x07) == DPS310_HW_SIMULATOR_COMMAND_PRESSURE) {
+            sensor->registers[register_address] &= (uint8_t) ~(0b1 << 4);
+            sensor->command = DPS310_HW_SIMULATOR_COMMAND_PRESSURE;
+            sensor->command_end_time_us = dps310_hw_simulator_ctx.time_us + prs_conversion_time_us;
+        }
+        if ((value & 0x07) == DPS310_HW_SIMULATOR_COMMAND_TEMPERATURE) {
+            sensor->registers[register_address] &= (uint8_t) ~(0b1 << 5);
+            sensor->command = DPS310_HW_SIMULATOR_COMMAND_TEMPERATURE;
+            sensor->command_end_time_us = dps310_hw_simulator_ctx.time_us + tmp_conversion_time_us;
+        }
+        // First background samples are available after one conversion.
+        sensor->next_prs_time_us = dps310_hw_simulator_ctx.time_us + prs_conversion_time_us;
+        sensor->next_tmp_time_us = dps310_hw_simulator_ctx.time_us + tmp_conversion_time_us;
+        break;
+    case DPS310_HW_SIMULATOR_REGISTER_RESET:
+        if ((value & 0x0F) == 0x09) {
+            _DPS310_HW_SIMULATOR_power_on(sensor);
+        }
+        if ((value & 0x80) != 0) {
+            sensor->fifo_count = 0;
+        }
+        break;
+    default:
+        // Read-only register.
+        break;
+    }
+}
+
+/*******************************************************************/
+static uint8_t _DPS310_HW_SIMULATOR_read_register(DPS310_HW_SIMULATOR_sensor_t* sensor, uint8_t register_address) {
+    // Local variables.
+    uint8_t idx = 0;
+    uint8_t value = 0;
+    // Out of range registers read as zero.
+    if (register_address >= DPS310_HW_SIMULATOR_NUMBER_OF_REGISTERS) goto end;
+    // FIFO entries are read through the pressure result registers.
+    if ((register_address == DPS310_HW_SIMULATOR_REGISTER_PRS_B2) && ((sensor->registers[DPS310_HW_SIMULATOR_REGISTER_CFG_REG] & 0x02) != 0)) {
+        if (sensor->fifo_count == 0) {
+            _DPS310_HW_SIMULATOR_write_result(sensor, DPS310_HW_SIMULATOR_REGISTER_PRS_B2, DPS310_HW_SIMULATOR_FIFO_EMPTY_RAW_VALUE);
+        }
+        else {
+            _DPS310_HW_SIMULATOR_write_result(sensor, DPS310_HW_SIMULATOR_REGISTER_PRS_B2, sensor->fifo[0]);
+            sensor->fifo_count--;
+            for (idx = 0; idx < sensor->fifo_count; idx++) {
+                sensor->fifo[idx] = sensor->fifo[idx + 1];
+            }
+        }
+    }
+    if (register_address == DPS310_HW_SIMULATOR_REGISTER_FIFO_STS) {
+        sensor->registers[register_address] = (uint8_t) (((sensor->fifo_count == 0) ? 0x01 : 0x00) | ((sensor->fifo_count >= DPS310_HW_SIMULATOR_FIFO_DEPTH) ? 0x02 : 0x00));
+    }
+    value = sensor->registers[register_address];
+    // Interrupt status is cleared when read.
+    if (register_address == DPS310_HW_SIMULATOR_REGISTER_INT_STS) {
+        sensor->registers[register_address] = 0x00;
+    }
+    // Ready flags are cleared when the corresponding result is read.
+    if (register_address == DPS310_HW_SIMULATOR_REGISTER_PRS_B0) {
+        sensor->registers[DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG] &= (uint8_t) ~(0b1 << 4);
+    }
+    if (register_address == DPS310_HW_SIMULATOR_REGISTER_TMP_B0) {
+        sensor->registers[DPS310_HW_SIMULATOR_REGISTER_MEAS_CFG] &= (uint8_t) ~(0b1 << 5);
+    }
+end:
+    return value;
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_transfer(uint8_t tx_data_size_bytes, uint8_t rx_data_size_bytes) {
+    // Local variables.
+    uint32_t number_of_bits = DPS310_HW_SIMULATOR_I2C_BITS_PER_TRANSACTION;
+    uint32_t transfer_time_us = 0;
+    // Each phase starts with the slave address byte.
+    if (tx_data_size_bytes != 0) {
+        number_of_bits += ((1 + (uint32_t) tx_data_size_bytes) * DPS310_HW_SIMULATOR_I2C_BITS_PER_BYTE);
+    }
+    if (rx_data_size_bytes != 0) {
+        number_of_bits += ((1 + (uint32_t) rx_data_size_bytes) * DPS310_HW_SIMULATOR_I2C_BITS_PER_BYTE);
+        // Repeated start.
+        if (tx_data_size_bytes != 0) {
+            number_of_bits++;
+        }
+    }
+    transfer_time_us = ((number_of_bits * 1000000) + (DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ - 1)) / DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ;
+    // Update time and statistics.
+    dps310_hw_simulator_ctx.time_us += transfer_time_us;
+    dps310_hw_simulator_ctx.statistics.time_us += transfer_time_us;
+    dps310_hw_simulator_ctx.statistics.i2c_transaction_count++;
+    dps310_hw_simulator_ctx.statistics.i2c_byte_count += ((uint32_t) tx_data_size_bytes + (uint32_t) rx_data_size_bytes);
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_write_data(DPS310_HW_SIMULATOR_sensor_t* sensor, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    uint8_t idx = 0;
+    // First byte is the register address, next ones are written with auto-increment.
+    sensor->register_pointer = data[0];
+    for (idx = 1; idx < data_size_bytes; idx++) {
+        _DPS310_HW_SIMULATOR_write_register(sensor, sensor->register_pointer, data[idx]);
+        sensor->register_pointer++;
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_HW_SIMULATOR_read_data(DPS310_HW_SIMULATOR_sensor_t* sensor, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    uint8_t idx = 0;
+    // Read registers with auto-increment.
+    for (idx = 0; idx < data_size_bytes; idx++) {
+        data[idx] = _DPS310_HW_SIMULATOR_read_register(sensor, sensor->register_pointer);
+        sensor->register_pointer++;
+    }
+}
+
+/*** DPS310 HW functions ***/
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_init(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t idx = 0;
+    // Combined write-read transfers and connected interrupt lines by default.
+    dps310_hw_simulator_ctx.write_read_split_flag = 0;
+    dps310_hw_simulator_ctx.interrupt_lines_flag = 1;
+    // Power on all sensors.
+    for (idx = 0; idx < DPS310_HW_SIMULATOR_NUMBER_OF_SENSORS; idx++) {
+        _DPS310_HW_SIMULATOR_write_coefficients_registers(&(dps310_hw_simulator_ctx.sensors[idx]), DPS310_HW_SIMULATOR_DEFAULT_COEFFICIENTS_REGISTERS);
+        dps310_hw_simulator_ctx.sensors[idx].prs_raw = DPS310_HW_SIMULATOR_DEFAULT_PRS_RAW;
+        dps310_hw_simulator_ctx.sensors[idx].tmp_raw = DPS310_HW_SIMULATOR_DEFAULT_TMP_RAW;
+        dps310_hw_simulator_ctx.sensors[idx].interrupt_callback = NULL;
+        dps310_hw_simulator_ctx.sensors[idx].interrupt_context = NULL;
+        _DPS310_HW_SIMULATOR_power_on(&(dps310_hw_simulator_ctx.sensors[idx]));
+    }
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_de_init(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_i2c_write(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes, uint8_t stop_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    UNUSED(stop_flag);
+    // Bus transfer.
+    _DPS310_HW_SIMULATOR_transfer(data_size_bytes, 0);
+    // Check acknowledge.
+    if ((sensor == NULL) || (data == NULL) || (data_size_bytes == 0)) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    _DPS310_HW_SIMULATOR_update(sensor);
+    _DPS310_HW_SIMULATOR_write_data(sensor, data, data_size_bytes);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_i2c_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* data, uint8_t data_size_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    // Bus transfer.
+    _DPS310_HW_SIMULATOR_transfer(0, data_size_bytes);
+    // Check acknowledge.
+    if ((sensor == NULL) || (data == NULL)) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    _DPS310_HW_SIMULATOR_update(sensor);
+    _DPS310_HW_SIMULATOR_read_data(sensor, data, data_size_bytes);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_i2c_write_read(uint8_t i2c_instance, uint8_t i2c_address, uint8_t* tx_data, uint8_t tx_data_size_bytes, uint8_t* rx_data, uint8_t rx_data_size_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    // Single bus transfer with repeated start, or separate write and read transfers of the generic fallback.
+    if (dps310_hw_simulator_ctx.write_read_split_flag == 0) {
+        _DPS310_HW_SIMULATOR_transfer(tx_data_size_bytes, rx_data_size_bytes);
+    }
+    else {
+        _DPS310_HW_SIMULATOR_transfer(tx_data_size_bytes, 0);
+        _DPS310_HW_SIMULATOR_transfer(0, rx_data_size_bytes);
+    }
+    // Check acknowledge.
+    if ((sensor == NULL) || (tx_data == NULL) || (tx_data_size_bytes == 0) || (rx_data == NULL)) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    _DPS310_HW_SIMULATOR_update(sensor);
+    _DPS310_HW_SIMULATOR_write_data(sensor, tx_data, tx_data_size_bytes);
+    _DPS310_HW_SIMULATOR_read_data(sensor, rx_data, rx_data_size_bytes);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_enable_interrupt(uint8_t i2c_instance, uint8_t i2c_address, DPS310_HW_interrupt_cb_t interrupt_callback, void* context) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    // Check parameters.
+    if (sensor == NULL) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    // Same behavior as the default implementation without interrupt line.
+    if (dps310_hw_simulator_ctx.interrupt_lines_flag == 0) {
+        status = DPS310_ERROR_INTERRUPT;
+        goto errors;
+    }
+    sensor->interrupt_callback = interrupt_callback;
+    sensor->interrupt_context = context;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_disable_interrupt(uint8_t i2c_instance, uint8_t i2c_address) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    // Check parameters.
+    if (sensor == NULL) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    sensor->interrupt_callback = NULL;
+    sensor->interrupt_context = NULL;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_wait_interrupt(uint8_t i2c_instance, uint8_t i2c_address, volatile uint8_t* interrupt_flag, uint32_t timeout_ms) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    uint32_t end_time_us = dps310_hw_simulator_ctx.time_us + (timeout_ms * 1000);
+    // Unused parameters.
+    UNUSED(i2c_instance);
+    // Check parameters.
+    if (sensor == NULL) {
+        status = DPS310_ERROR_BASE_I2C;
+        goto errors;
+    }
+    if (sensor->interrupt_callback == NULL) {
+        status = DPS310_ERROR_INTERRUPT;
+        goto errors;
+    }
+    // Sleep until the callback sets the flag.
+    while (((*interrupt_flag) == 0) && (_DPS310_HW_SIMULATOR_is_time_reached(end_time_us) == 0)) {
+        _DPS310_HW_SIMULATOR_sleep(DPS310_HW_SIMULATOR_WAIT_STEP_US);
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_delay_milliseconds(uint32_t delay_ms) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Simulated time only.
+    _DPS310_HW_SIMULATOR_sleep(delay_ms * 1000);
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_get_timestamp_us(uint32_t* timestamp_us) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Simulated time.
+    (*timestamp_us) = dps310_hw_simulator_ctx.time_us;
+    return status;
+}
+
+/*** DPS310 HW SIMULATOR functions ***/
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_coefficients_registers(uint8_t i2c_address, uint8_t* coefficients_registers) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Check parameters.
+    if ((sensor == NULL) || (coefficients_registers == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    _DPS310_HW_SIMULATOR_write_coefficients_registers(sensor, coefficients_registers);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_raw_results(uint8_t i2c_address, int32_t prs_raw, int32_t tmp_raw) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_sensor_t* sensor = _DPS310_HW_SIMULATOR_get_sensor(i2c_address);
+    // Check parameters.
+    if (sensor == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    sensor->prs_raw = prs_raw;
+    sensor->tmp_raw = tmp_raw;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_write_read_split(uint8_t write_read_split_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Update flag.
+    dps310_hw_simulator_ctx.write_read_split_flag = (write_read_split_flag != 0) ? 1 : 0;
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_set_interrupt_lines(uint8_t interrupt_lines_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Update flag.
+    dps310_hw_simulator_ctx.interrupt_lines_flag = (interrupt_lines_flag != 0) ? 1 : 0;
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_get_statistics(DPS310_HW_SIMULATOR_statistics_t* statistics) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (statistics == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*statistics) = dps310_hw_simulator_ctx.statistics;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_HW_SIMULATOR_reset_statistics(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Reset counters.
+    dps310_hw_simulator_ctx.statistics.i2c_transaction_count = 0;
+    dps310_hw_simulator_ctx.statistics.i2c_byte_count = 0;
+    dps310_hw_simulator_ctx.statistics.time_us = 0;
+    return status;
+}
+
+#endif /* DPS310_DRIVER_DISABLE and DPS310_DRIVER_HW_SIMULATOR */
@@ -0,0 +1,536 @@
+/*
+ * dps310_log.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include "dps310_log.h"
+
+#ifndef DPS310_DRIVER_DISABLE_FLAGS_FILE
+#include "dps310_driver_flags.h"
+#endif
+#include "dps310.h"
+#include "types.h"
+
+#ifndef DPS310_DRIVER_DISABLE
+
+/*** DPS310 LOG local macros ***/
+
+#define DPS310_LOG_HEADER_MAGIC                 0xD310
+#define DPS310_LOG_HEADER_VERSION               0x01
+
+// Header layout (multi-bytes fields are big-endian).
+#define DPS310_LOG_HEADER_INDEX_MAGIC           0
+#define DPS310_LOG_HEADER_INDEX_VERSION         2
+#define DPS310_LOG_HEADER_INDEX_PRESSURE        3 // Rate (bits 7-4) and oversampling (bits 3-0).
+#define DPS310_LOG_HEADER_INDEX_TEMPERATURE     4 // Rate (bits 7-4) and oversampling (bits 3-0).
+#define DPS310_LOG_HEADER_INDEX_UNITS           5 // Pressure unit (bits 7-4) and temperature unit (bits 3-0).
+#define DPS310_LOG_HEADER_INDEX_TIMESTAMP       6
+#define DPS310_LOG_HEADER_INDEX_COEFFICIENTS    10
+#define DPS310_LOG_HEADER_INDEX_CRC             (DPS310_LOG_HEADER_INDEX_COEFFICIENTS + (DPS310_LOG_NUMBER_OF_COEFFICIENTS * 4))
+#define DPS310_LOG_HEADER_CRC_POLYNOMIAL        0x1021
+#define DPS310_LOG_HEADER_CRC_INIT              0xFFFF
+
+#define DPS310_LOG_NUMBER_OF_COEFFICIENTS       9
+
+// Record first byte: temperature flag (bit 7), delta extension flag (bit 6) and delta timestamp bits 5-0.
+// Each extension byte gives 7 more bits of the delta timestamp (bit 7 set when another byte follows).
+#define DPS310_LOG_RECORD_TEMPERATURE_FLAG      0x80
+#define DPS310_LOG_RECORD_EXTENSION_FLAG        0x40
+#define DPS310_LOG_RECORD_DELTA_FIRST_MASK      0x3F
+#define DPS310_LOG_RECORD_DELTA_FIRST_BITS      6
+#define DPS310_LOG_RECORD_DELTA_MORE_FLAG       0x80
+#define DPS310_LOG_RECORD_DELTA_MORE_MASK       0x7F
+#define DPS310_LOG_RECORD_DELTA_MORE_BITS       7
+#define DPS310_LOG_RECORD_EXTENSION_SIZE_MAX    4
+#define DPS310_LOG_RECORD_RAW_SIZE_BYTES        3
+
+// Number of samples compensated at once during replay.
+#define DPS310_LOG_REPLAY_BLOCK_SIZE            32
+
+/*** DPS310 LOG local functions ***/
+
+/*******************************************************************/
+static void _DPS310_LOG_write_uint32(uint8_t* data, uint32_t value) {
+    // Big-endian.
+    data[0] = (uint8_t) (value >> 24);
+    data[1] = (uint8_t) (value >> 16);
+    data[2] = (uint8_t) (value >> 8);
+    data[3] = (uint8_t) (value);
+}
+
+/*******************************************************************/
+static uint32_t _DPS310_LOG_read_uint32(uint8_t* data) {
+    // Big-endian.
+    return (((uint32_t) data[0] << 24) | ((uint32_t) data[1] << 16) | ((uint32_t) data[2] << 8) | ((uint32_t) data[3]));
+}
+
+/*******************************************************************/
+static uint16_t _DPS310_LOG_compute_header_crc(uint8_t* header) {
+    // Local variables.
+    uint16_t crc = DPS310_LOG_HEADER_CRC_INIT;
+    uint8_t idx = 0;
+    uint8_t bit_idx = 0;
+    // CRC-16-CCITT of all bytes preceding the CRC field.
+    for (idx = 0; idx < DPS310_LOG_HEADER_INDEX_CRC; idx++) {
+        crc ^= (uint16_t) (header[idx] << 8);
+        for (bit_idx = 0; bit_idx < 8; bit_idx++) {
+            crc = ((crc & 0x8000) != 0) ? (uint16_t) ((crc << 1) ^ DPS310_LOG_HEADER_CRC_POLYNOMIAL) : (uint16_t) (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_LOG_write_record(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, uint8_t temperature_flag, int32_t raw) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t* record = NULL;
+    uint32_t delta_us = (timestamp_us - encoder->timestamp_us);
+    uint8_t record_size = 0;
+    // Check state.
+    if (encoder->header_written_flag == 0) {
+        status = DPS310_ERROR_LOG_HEADER;
+        goto errors;
+    }
+    // Check remaining space (worst case, records are never split).
+    if ((encoder->buffer_size_bytes - encoder->buffer_index) < DPS310_LOG_RECORD_SIZE_MAX) {
+        status = DPS310_ERROR_LOG_BUFFER_SIZE;
+        goto errors;
+    }
+    record = &(encoder->buffer[encoder->buffer_index]);
+    // Type and delta timestamp.
+    record[0] = (uint8_t) ((temperature_flag != 0) ? DPS310_LOG_RECORD_TEMPERATURE_FLAG : 0x00);
+    record[0] |= (uint8_t) (delta_us & DPS310_LOG_RECORD_DELTA_FIRST_MASK);
+    delta_us >>= DPS310_LOG_RECORD_DELTA_FIRST_BITS;
+    record_size = 1;
+    if (delta_us != 0) {
+        record[0] |= DPS310_LOG_RECORD_EXTENSION_FLAG;
+        while (delta_us > DPS310_LOG_RECORD_DELTA_MORE_MASK) {
+            record[record_size++] = (uint8_t) ((delta_us & DPS310_LOG_RECORD_DELTA_MORE_MASK) | DPS310_LOG_RECORD_DELTA_MORE_FLAG);
+            delta_us >>= DPS310_LOG_RECORD_DELTA_MORE_BITS;
+        }
+        record[record_size++] = (uint8_t) (delta_us);
+    }
+    // 24-bits raw value.
+    record[record_size++] = (uint8_t) (raw >> 16);
+    record[record_size++] = (uint8_t) (raw >> 8);
+    record[record_size++] = (uint8_t) (raw);
+    // Update encoder.
+    encoder->buffer_index += record_size;
+    encoder->timestamp_us = timestamp_us;
+    if (temperature_flag != 0) {
+        encoder->tmp_raw = raw;
+        encoder->tmp_raw_written_flag = 1;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_LOG_write_pressure(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t prs_raw) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // A pressure can not be compensated without a previous temperature.
+    if (encoder->tmp_raw_written_flag == 0) {
+        status = DPS310_ERROR_LOG_RECORD;
+        goto errors;
+    }
+    status = _DPS310_LOG_write_record(encoder, timestamp_us, 0, prs_raw);
+errors:
+    return status;
+}
+
+/*** DPS310 LOG functions ***/
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_init_encoder(DPS310_LOG_encoder_t* encoder, uint8_t* buffer, uint32_t buffer_size_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((encoder == NULL) || (buffer == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (buffer_size_bytes < DPS310_LOG_HEADER_SIZE_BYTES) {
+        status = DPS310_ERROR_LOG_BUFFER_SIZE;
+        goto errors;
+    }
+    // Init context.
+    encoder->buffer = buffer;
+    encoder->buffer_size_bytes = buffer_size_bytes;
+    encoder->buffer_index = 0;
+    encoder->header_written_flag = 0;
+    encoder->tmp_raw_written_flag = 0;
+    encoder->tmp_raw = 0;
+    encoder->timestamp_us = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_write_header(DPS310_LOG_encoder_t* encoder, DPS310_coefficients_t* coefficients, DPS310_configuration_t* configuration, uint32_t timestamp_us) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t* header = NULL;
+    int32_t coefficients_array[DPS310_LOG_NUMBER_OF_COEFFICIENTS];
+    uint16_t crc = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((encoder == NULL) || (coefficients == NULL) || (configuration == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if ((configuration->pressure_rate >= DPS310_MEASUREMENT_RATE_LAST) || (configuration->temperature_rate >= DPS310_MEASUREMENT_RATE_LAST)) {
+        status = DPS310_ERROR_MEASUREMENT_RATE;
+        goto errors;
+    }
+    if ((configuration->pressure_oversampling >= DPS310_OVERSAMPLING_LAST) || (configuration->temperature_oversampling >= DPS310_OVERSAMPLING_LAST)) {
+        status = DPS310_ERROR_OVERSAMPLING;
+        goto errors;
+    }
+    if ((configuration->pressure_unit >= DPS310_PRESSURE_UNIT_LAST) || (configuration->temperature_unit >= DPS310_TEMPERATURE_UNIT_LAST)) {
+        status = DPS310_ERROR_UNIT;
+        goto errors;
+    }
+    if ((encoder->buffer_size_bytes - encoder->buffer_index) < DPS310_LOG_HEADER_SIZE_BYTES) {
+        status = DPS310_ERROR_LOG_BUFFER_SIZE;
+        goto errors;
+    }
+    header = &(encoder->buffer[encoder->buffer_index]);
+    // Build header.
+    header[DPS310_LOG_HEADER_INDEX_MAGIC] = (uint8_t) (DPS310_LOG_HEADER_MAGIC >> 8);
+    header[DPS310_LOG_HEADER_INDEX_MAGIC + 1] = (uint8_t) (DPS310_LOG_HEADER_MAGIC);
+    header[DPS310_LOG_HEADER_INDEX_VERSION] = DPS310_LOG_HEADER_VERSION;
+    header[DPS310_LOG_HEADER_INDEX_PRESSURE] = (uint8_t) ((configuration->pressure_rate << 4) | (configuration->pressure_oversampling));
+    header[DPS310_LOG_HEADER_INDEX_TEMPERATURE] = (uint8_t) ((configuration->temperature_rate << 4) | (configuration->temperature_oversampling));
+    header[DPS310_LOG_HEADER_INDEX_UNITS] = (uint8_t) ((configuration->pressure_unit << 4) | (configuration->temperature_unit));
+    _DPS310_LOG_write_uint32(&(header[DPS310_LOG_HEADER_INDEX_TIMESTAMP]), timestamp_us);
+    coefficients_array[0] = coefficients->c0;
+    coefficients_array[1] = coefficients->c1;
+    coefficients_array[2] = coefficients->c00;
+    coefficients_array[3] = coefficients->c10;
+    coefficients_array[4] = coefficients->c01;
+    coefficients_array[5] = coefficients->c11;
+    coefficients_array[6] = coefficients->c20;
+    coefficients_array[7] = coefficients->c21;
+    coefficients_array[8] = coefficients->c30;
+    for (idx = 0; idx < DPS310_LOG_NUMBER_OF_COEFFICIENTS; idx++) {
+        _DPS310_LOG_write_uint32(&(header[DPS310_LOG_HEADER_INDEX_COEFFICIENTS + (idx * 4)]), (uint32_t) coefficients_array[idx]);
+    }
+    crc = _DPS310_LOG_compute_header_crc(header);
+    header[DPS310_LOG_HEADER_INDEX_CRC] = (uint8_t) (crc >> 8);
+    header[DPS310_LOG_HEADER_INDEX_CRC + 1] = (uint8_t) (crc);
+    // Records of the new log are relative to the header.
+    encoder->buffer_index += DPS310_LOG_HEADER_SIZE_BYTES;
+    encoder->header_written_flag = 1;
+    encoder->tmp_raw_written_flag = 0;
+    encoder->tmp_raw = 0;
+    encoder->timestamp_us = timestamp_us;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_write_temperature(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t tmp_raw) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (encoder == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    status = _DPS310_LOG_write_record(encoder, timestamp_us, 1, tmp_raw);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_write_measurement(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, int32_t prs_raw, int32_t tmp_raw) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_LOG_encoder_t encoder_backup;
+    // Check parameters.
+    if (encoder == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    encoder_backup = (*encoder);
+    // Temperature is skipped when it has been reused for this measurement.
+    if ((encoder->tmp_raw_written_flag == 0) || (tmp_raw != encoder->tmp_raw)) {
+        status = _DPS310_LOG_write_record(encoder, timestamp_us, 1, tmp_raw);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+    status = _DPS310_LOG_write_pressure(encoder, timestamp_us, prs_raw);
+    if (status != DPS310_SUCCESS) {
+        // Keep the measurement atomic.
+        (*encoder) = encoder_backup;
+        goto errors;
+    }
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_write_fifo(DPS310_LOG_encoder_t* encoder, uint32_t timestamp_us, uint32_t pressure_period_us, DPS310_fifo_sample_t* samples, uint8_t number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_LOG_encoder_t encoder_backup;
+    uint8_t number_of_pressure_samples = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((encoder == NULL) || (samples == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    encoder_backup = (*encoder);
+    // Count pressure entries to date them backwards.
+    for (idx = 0; idx < number_of_samples; idx++) {
+        if (samples[idx].type == DPS310_FIFO_SAMPLE_TYPE_PRESSURE) {
+            number_of_pressure_samples++;
+        }
+    }
+    if (number_of_pressure_samples != 0) {
+        timestamp_us -= ((uint32_t) (number_of_pressure_samples - 1) * pressure_period_us);
+    }
+    // Temperature entries are dated with the next pressure entry.
+    for (idx = 0; idx < number_of_samples; idx++) {
+        if (samples[idx].type == DPS310_FIFO_SAMPLE_TYPE_TEMPERATURE) {
+            status = _DPS310_LOG_write_record(encoder, timestamp_us, 1, samples[idx].value);
+            if (status != DPS310_SUCCESS) goto errors;
+            continue;
+        }
+        status = _DPS310_LOG_write_pressure(encoder, timestamp_us, samples[idx].value);
+        if (status != DPS310_SUCCESS) goto errors;
+        timestamp_us += pressure_period_us;
+    }
+errors:
+    // Drop the whole drain on failure.
+    if ((status != DPS310_SUCCESS) && (status != DPS310_ERROR_NULL_PARAMETER)) {
+        (*encoder) = encoder_backup;
+    }
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_flush(DPS310_LOG_encoder_t* encoder, uint32_t* number_of_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if ((encoder == NULL) || (number_of_bytes == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*number_of_bytes) = encoder->buffer_index;
+    encoder->buffer_index = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_init_decoder(DPS310_LOG_decoder_t* decoder) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Check parameters.
+    if (decoder == NULL) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    // Init context.
+    decoder->header_read_flag = 0;
+    decoder->tmp_raw_valid_flag = 0;
+    decoder->tmp_raw = 0;
+    decoder->timestamp_us = 0;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_read_header(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    int32_t coefficients_array[DPS310_LOG_NUMBER_OF_COEFFICIENTS];
+    uint16_t crc = 0;
+    uint8_t idx = 0;
+    // Check parameters.
+    if ((decoder == NULL) || (data == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    decoder->header_read_flag = 0;
+    if (data_size_bytes < DPS310_LOG_HEADER_SIZE_BYTES) {
+        status = DPS310_ERROR_LOG_BUFFER_SIZE;
+        goto errors;
+    }
+    // Check format and integrity.
+    if ((data[DPS310_LOG_HEADER_INDEX_MAGIC] != (uint8_t) (DPS310_LOG_HEADER_MAGIC >> 8)) || (data[DPS310_LOG_HEADER_INDEX_MAGIC + 1] != (uint8_t) (DPS310_LOG_HEADER_MAGIC)) || (data[DPS310_LOG_HEADER_INDEX_VERSION] != DPS310_LOG_HEADER_VERSION)) {
+        status = DPS310_ERROR_LOG_HEADER;
+        goto errors;
+    }
+    crc = _DPS310_LOG_compute_header_crc(data);
+    if ((data[DPS310_LOG_HEADER_INDEX_CRC] != (uint8_t) (crc >> 8)) || (data[DPS310_LOG_HEADER_INDEX_CRC + 1] != (uint8_t) (crc))) {
+        status = DPS310_ERROR_LOG_HEADER;
+        goto errors;
+    }
+    // Decode configuration.
+    decoder->configuration.pressure_rate = (DPS310_measurement_rate_t) (data[DPS310_LOG_HEADER_INDEX_PRESSURE] >> 4);
+    decoder->configuration.pressure_oversampling = (DPS310_oversampling_t) (data[DPS310_LOG_HEADER_INDEX_PRESSURE] & 0x0F);
+    decoder->configuration.temperature_rate = (DPS310_measurement_rate_t) (data[DPS310_LOG_HEADER_INDEX_TEMPERATURE] >> 4);
+    decoder->configuration.temperature_oversampling = (DPS310_oversampling_t) (data[DPS310_LOG_HEADER_INDEX_TEMPERATURE] & 0x0F);
+    decoder->configuration.pressure_unit = (DPS310_pressure_unit_t) (data[DPS310_LOG_HEADER_INDEX_UNITS] >> 4);
+    decoder->configuration.temperature_unit = (DPS310_temperature_unit_t) (data[DPS310_LOG_HEADER_INDEX_UNITS] & 0x0F);
+    decoder->configuration.temperature_period = 0;
+    if ((decoder->configuration.pressure_rate >= DPS310_MEASUREMENT_RATE_LAST) || (decoder->configuration.temperature_rate >= DPS310_MEASUREMENT_RATE_LAST) ||
+        (decoder->configuration.pressure_oversampling >= DPS310_OVERSAMPLING_LAST) || (decoder->configuration.temperature_oversampling >= DPS310_OVERSAMPLING_LAST) ||
+        (decoder->configuration.pressure_unit >= DPS310_PRESSURE_UNIT_LAST) || (decoder->configuration.temperature_unit >= DPS310_TEMPERATURE_UNIT_LAST)) {
+        status = DPS310_ERROR_LOG_HEADER;
+        goto errors;
+    }
+    // Decode coefficients.
+    for (idx = 0; idx < DPS310_LOG_NUMBER_OF_COEFFICIENTS; idx++) {
+        coefficients_array[idx] = (int32_t) _DPS310_LOG_read_uint32(&(data[DPS310_LOG_HEADER_INDEX_COEFFICIENTS + (idx * 4)]));
+    }
+    decoder->coefficients.c0 = coefficients_array[0];
+    decoder->coefficients.c1 = coefficients_array[1];
+    decoder->coefficients.c00 = coefficients_array[2];
+    decoder->coefficients.c10 = coefficients_array[3];
+    decoder->coefficients.c01 = coefficients_array[4];
+    decoder->coefficients.c11 = coefficients_array[5];
+    decoder->coefficients.c20 = coefficients_array[6];
+    decoder->coefficients.c21 = coefficients_array[7];
+    decoder->coefficients.c30 = coefficients_array[8];
+    // Records are relative to the header.
+    decoder->timestamp_us = _DPS310_LOG_read_uint32(&(data[DPS310_LOG_HEADER_INDEX_TIMESTAMP]));
+    decoder->tmp_raw_valid_flag = 0;
+    decoder->tmp_raw = 0;
+    decoder->header_read_flag = 1;
+errors:
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_read_samples(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes, uint32_t* timestamp_us, int32_t* prs_raw, int32_t* tmp_raw, uint32_t samples_size, uint32_t* number_of_samples, uint32_t* number_of_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint32_t data_idx = 0;
+    uint32_t record_idx = 0;
+    uint32_t delta_us = 0;
+    uint8_t delta_shift = 0;
+    uint8_t extension_size = 0;
+    uint8_t tag = 0;
+    int32_t raw = 0;
+    // Check parameters.
+    if ((decoder == NULL) || (data == NULL) || (timestamp_us == NULL) || (prs_raw == NULL) || (tmp_raw == NULL) || (number_of_samples == NULL) || (number_of_bytes == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*number_of_samples) = 0;
+    (*number_of_bytes) = 0;
+    if (decoder->header_read_flag == 0) {
+        status = DPS310_ERROR_LOG_HEADER;
+        goto errors;
+    }
+    while (((*number_of_samples) < samples_size) && (data_idx < data_size_bytes)) {
+        // Type and delta timestamp.
+        record_idx = data_idx;
+        tag = data[record_idx++];
+        delta_us = (uint32_t) (tag & DPS310_LOG_RECORD_DELTA_FIRST_MASK);
+        if ((tag & DPS310_LOG_RECORD_EXTENSION_FLAG) != 0) {
+            delta_shift = DPS310_LOG_RECORD_DELTA_FIRST_BITS;
+            extension_size = 0;
+            do {
+                if (record_idx >= data_size_bytes) goto errors;
+                if (extension_size >= DPS310_LOG_RECORD_EXTENSION_SIZE_MAX) {
+                    status = DPS310_ERROR_LOG_RECORD;
+                    goto errors;
+                }
+                delta_us |= ((uint32_t) (data[record_idx] & DPS310_LOG_RECORD_DELTA_MORE_MASK) << delta_shift);
+                delta_shift = (uint8_t) (delta_shift + DPS310_LOG_RECORD_DELTA_MORE_BITS);
+                extension_size++;
+            }
+            while ((data[record_idx++] & DPS310_LOG_RECORD_DELTA_MORE_FLAG) != 0);
+        }
+        // Wait for the rest of the record.
+        if ((data_size_bytes - record_idx) < DPS310_LOG_RECORD_RAW_SIZE_BYTES) goto errors;
+        // 24-bits signed raw value.
+        raw = (int32_t) (((uint32_t) data[record_idx] << 16) | ((uint32_t) data[record_idx + 1] << 8) | ((uint32_t) data[record_idx + 2]));
+        if ((raw & 0x00800000) != 0) {
+            raw |= (int32_t) 0xFF000000;
+        }
+        record_idx += DPS310_LOG_RECORD_RAW_SIZE_BYTES;
+        if ((tag & DPS310_LOG_RECORD_TEMPERATURE_FLAG) != 0) {
+            decoder->tmp_raw = raw;
+            decoder->tmp_raw_valid_flag = 1;
+        }
+        else {
+            if (decoder->tmp_raw_valid_flag == 0) {
+                status = DPS310_ERROR_LOG_RECORD;
+                goto errors;
+            }
+            timestamp_us[*number_of_samples] = (decoder->timestamp_us + delta_us);
+            prs_raw[*number_of_samples] = raw;
+            tmp_raw[*number_of_samples] = decoder->tmp_raw;
+            (*number_of_samples)++;
+        }
+        // Record consumed.
+        decoder->timestamp_us += delta_us;
+        data_idx = record_idx;
+    }
+errors:
+    if (number_of_bytes != NULL) {
+        (*number_of_bytes) = data_idx;
+    }
+    return status;
+}
+
+/*******************************************************************/
+DPS310_status_t DPS310_LOG_replay(DPS310_LOG_decoder_t* decoder, uint8_t* data, uint32_t data_size_bytes, DPS310_sample_t* samples, uint32_t samples_size, uint32_t* number_of_samples, uint32_t* number_of_bytes) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_status_t read_status = DPS310_SUCCESS;
+    uint32_t timestamp_us[DPS310_LOG_REPLAY_BLOCK_SIZE];
+    int32_t prs_raw[DPS310_LOG_REPLAY_BLOCK_SIZE];
+    int32_t tmp_raw[DPS310_LOG_REPLAY_BLOCK_SIZE];
+    int32_t pressure[DPS310_LOG_REPLAY_BLOCK_SIZE];
+    int32_t temperature[DPS310_LOG_REPLAY_BLOCK_SIZE];
+    uint32_t block_size = 0;
+    uint32_t block_number_of_samples = 0;
+    uint32_t block_number_of_bytes = 0;
+    uint32_t idx = 0;
+    // Check parameters.
+    if ((decoder == NULL) || (data == NULL) || (samples == NULL) || (number_of_samples == NULL) || (number_of_bytes == NULL)) {
+        status = DPS310_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    (*number_of_samples) = 0;
+    (*number_of_bytes) = 0;
+    // Decode and compensate by blocks.
+    while ((*number_of_samples) < samples_size) {
+        block_size = (samples_size - (*number_of_samples));
+        if (block_size > DPS310_LOG_REPLAY_BLOCK_SIZE) {
+            block_size = DPS310_LOG_REPLAY_BLOCK_SIZE;
+        }
+        // Samples decoded before an invalid record are still compensated.
+        read_status = DPS310_LOG_read_samples(decoder, &(data[*number_of_bytes]), (data_size_bytes - (*number_of_bytes)), timestamp_us, prs_raw, tmp_raw, block_size, &block_number_of_samples, &block_number_of_bytes);
+        (*number_of_bytes) += block_number_of_bytes;
+        if (block_number_of_samples != 0) {
+            status = DPS310_compensate(&(decoder->coefficients), &(decoder->configuration), prs_raw, tmp_raw, pressure, temperature, block_number_of_samples);
+            if (status != DPS310_SUCCESS) goto errors;
+            for (idx = 0; idx < block_number_of_samples; idx++) {
+                samples[*number_of_samples].timestamp_us = timestamp_us[idx];
+                samples[*number_of_samples].pressure = pressure[idx];
+                samples[*number_of_samples].temperature = temperature[idx];
+                (*number_of_samples)++;
+            }
+        }
+        status = read_status;
+        if (status != DPS310_SUCCESS) goto errors;
+        // End of data or incomplete record.
+        if (block_number_of_samples < block_size) break;
+    }
+errors:
+    return status;
+}
+
+#endif /* DPS310_DRIVER_DISABLE */
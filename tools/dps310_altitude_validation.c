@@ -0,0 +1,223 @@
+/*
+ * dps310_altitude_validation.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dps310.h"
+#include "dps310_altitude.h"
+#include "types.h"
+
+/*** DPS310 ALTITUDE VALIDATION local macros ***/
+
+// Standard atmosphere: h = (T0 / L) * (1 - (p / p0)^(R * L / (g * M))).
+#define DPS310_ALTITUDE_VALIDATION_SCALE_HEIGHT_MM      44330769.0
+#define DPS310_ALTITUDE_VALIDATION_EXPONENT             0.190263
+
+// Reference pressure step (the last supported reference pressure is always included).
+#define DPS310_ALTITUDE_VALIDATION_REFERENCE_STEP_PA    64
+
+// Maximum errors documented in DPS310_ALTITUDE_compute() (the worst case found with a 1 Pa reference step is 6.06 mm
+// at 29915 Pa, near 116701 Pa).
+#define DPS310_ALTITUDE_VALIDATION_ERROR_MAX_MM         6.5
+#define DPS310_ALTITUDE_VALIDATION_ERROR_MAX_40KPA_MM   5.0
+
+// Vertical speed filter scenario: 40 s climb at 2.5 m/s then 40 s descent at 1.5 m/s, sampled at 8 Hz with a timestamps jitter.
+#define DPS310_ALTITUDE_VALIDATION_FILTER_PERIOD_US     125000
+#define DPS310_ALTITUDE_VALIDATION_FILTER_JITTER_US     1500
+#define DPS310_ALTITUDE_VALIDATION_FILTER_SAMPLES       640
+#define DPS310_ALTITUDE_VALIDATION_FILTER_CLIMB_MM_S    2500.0
+#define DPS310_ALTITUDE_VALIDATION_FILTER_DESCENT_MM_S  (-1500.0)
+#define DPS310_ALTITUDE_VALIDATION_FILTER_GROUND_PA     95000.0
+// Maximum differences allowed with the floating-point filter fed with the same altitudes (the driver filter state is
+// rounded to 1 mm and 1 mm/s on each sample).
+#define DPS310_ALTITUDE_VALIDATION_FILTER_ALTITUDE_MM   20.0
+#define DPS310_ALTITUDE_VALIDATION_FILTER_SPEED_MM_S    15.0
+
+#define DPS310_ALTITUDE_VALIDATION_PRESSURE_MIN_Q6      (DPS310_ALTITUDE_PRESSURE_MIN_PA << 6)
+#define DPS310_ALTITUDE_VALIDATION_PRESSURE_MAX_Q6      ((DPS310_ALTITUDE_PRESSURE_MAX_PA << 6) - 1)
+
+/*** DPS310 ALTITUDE VALIDATION local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char* name;
+    int32_t reference_min_pa;
+    int32_t reference_max_pa;
+    double error_limit_mm;
+    double error_max_mm;
+    int32_t error_max_reference_pa;
+    int32_t error_max_pressure_q6;
+} DPS310_ALTITUDE_VALIDATION_band_t;
+
+/*** DPS310 ALTITUDE VALIDATION local global variables ***/
+
+// Reference pressure bands of the report.
+static DPS310_ALTITUDE_VALIDATION_band_t dps310_altitude_validation_bands[] = {
+    { "297-400hPa", DPS310_ALTITUDE_PRESSURE_MIN_PA, 40000, DPS310_ALTITUDE_VALIDATION_ERROR_MAX_MM, 0.0, 0, 0 },
+    { "400-700hPa", 40000, 70000, DPS310_ALTITUDE_VALIDATION_ERROR_MAX_40KPA_MM, 0.0, 0, 0 },
+    { "700-1000hPa", 70000, 100000, DPS310_ALTITUDE_VALIDATION_ERROR_MAX_40KPA_MM, 0.0, 0, 0 },
+    { "1000-1203hPa", 100000, DPS310_ALTITUDE_PRESSURE_MAX_PA, DPS310_ALTITUDE_VALIDATION_ERROR_MAX_40KPA_MM, 0.0, 0, 0 },
+};
+
+/*** DPS310 ALTITUDE VALIDATION local functions ***/
+
+/*******************************************************************/
+static int _DPS310_ALTITUDE_VALIDATION_check_reference(int32_t reference_pa, int32_t pressure_step_q6, const double* pressure_power, DPS310_ALTITUDE_VALIDATION_band_t* band) {
+    // Local variables.
+    DPS310_ALTITUDE_handle_t handle;
+    DPS310_status_t status = DPS310_SUCCESS;
+    double reference_power = pow((double) reference_pa, DPS310_ALTITUDE_VALIDATION_EXPONENT);
+    double altitude_reference_mm = 0.0;
+    double error_mm = 0.0;
+    int32_t altitude_mm = 0;
+    int32_t pressure_q6 = 0;
+    uint32_t idx = 0;
+    // Compare all pressures to the floating-point formula.
+    status = DPS310_ALTITUDE_init_handle(&handle, DPS310_PRESSURE_UNIT_PA_Q6, (reference_pa << 6));
+    if (status != DPS310_SUCCESS) goto errors;
+    for (pressure_q6 = DPS310_ALTITUDE_VALIDATION_PRESSURE_MIN_Q6; pressure_q6 <= DPS310_ALTITUDE_VALIDATION_PRESSURE_MAX_Q6; pressure_q6 += pressure_step_q6) {
+        status = DPS310_ALTITUDE_compute(&handle, pressure_q6, &altitude_mm);
+        if (status != DPS310_SUCCESS) goto errors;
+        altitude_reference_mm = DPS310_ALTITUDE_VALIDATION_SCALE_HEIGHT_MM * (1.0 - (pressure_power[idx] / reference_power));
+        error_mm = fabs(((double) altitude_mm) - altitude_reference_mm);
+        if (error_mm > band->error_max_mm) {
+            band->error_max_mm = error_mm;
+            band->error_max_reference_pa = reference_pa;
+            band->error_max_pressure_q6 = pressure_q6;
+        }
+        idx++;
+    }
+errors:
+    if (status != DPS310_SUCCESS) {
+        printf("DPS310_ALTITUDE error 0x%04x (reference %d Pa, pressure %d Pa Q6)\n", (unsigned int) status, (int) reference_pa, (int) pressure_q6);
+    }
+    return ((status == DPS310_SUCCESS) ? 0 : 1);
+}
+
+/*******************************************************************/
+static int _DPS310_ALTITUDE_VALIDATION_check_filter(void) {
+    // Local variables.
+    DPS310_ALTITUDE_handle_t handle;
+    DPS310_status_t status = DPS310_SUCCESS;
+    double true_altitude_mm = 0.0;
+    double altitude_reference_mm = 0.0;
+    double speed_reference_mm_s = 0.0;
+    double residual_mm = 0.0;
+    double delta_s = 0.0;
+    double altitude_error_max_mm = 0.0;
+    double speed_error_max_mm_s = 0.0;
+    int32_t pressure_q6 = 0;
+    int32_t measured_altitude_mm = 0;
+    int32_t altitude_mm = 0;
+    int32_t vertical_speed_mm_s = 0;
+    uint32_t timestamp_us = 0;
+    uint32_t last_timestamp_us = 0;
+    uint32_t idx = 0;
+    int failure = 0;
+    // Ground pressure as reference, with default gains.
+    status = DPS310_ALTITUDE_init_handle(&handle, DPS310_PRESSURE_UNIT_PA_Q6, (int32_t) (DPS310_ALTITUDE_VALIDATION_FILTER_GROUND_PA * 64.0));
+    if (status != DPS310_SUCCESS) goto errors;
+    for (idx = 0; idx < DPS310_ALTITUDE_VALIDATION_FILTER_SAMPLES; idx++) {
+        // Dated sample of the trajectory (timestamps wrap during the scenario).
+        timestamp_us = (uint32_t) (0xFFF00000UL + (idx * DPS310_ALTITUDE_VALIDATION_FILTER_PERIOD_US) + (((idx * 7) % 5) * DPS310_ALTITUDE_VALIDATION_FILTER_JITTER_US));
+        true_altitude_mm += ((idx == 0) ? 0.0 : ((double) (uint32_t) (timestamp_us - last_timestamp_us) / 1000000.0) * ((idx < (DPS310_ALTITUDE_VALIDATION_FILTER_SAMPLES >> 1)) ? DPS310_ALTITUDE_VALIDATION_FILTER_CLIMB_MM_S : DPS310_ALTITUDE_VALIDATION_FILTER_DESCENT_MM_S));
+        pressure_q6 = (int32_t) (64.0 * DPS310_ALTITUDE_VALIDATION_FILTER_GROUND_PA * pow(1.0 - (true_altitude_mm / DPS310_ALTITUDE_VALIDATION_SCALE_HEIGHT_MM), 1.0 / DPS310_ALTITUDE_VALIDATION_EXPONENT));
+        status = DPS310_ALTITUDE_compute(&handle, pressure_q6, &measured_altitude_mm);
+        if (status != DPS310_SUCCESS) goto errors;
+        status = DPS310_ALTITUDE_update(&handle, pressure_q6, timestamp_us, &altitude_mm, &vertical_speed_mm_s);
+        if (status != DPS310_SUCCESS) goto errors;
+        // Floating-point alpha-beta filter fed with the same altitude.
+        if (idx == 0) {
+            altitude_reference_mm = (double) measured_altitude_mm;
+            speed_reference_mm_s = 0.0;
+        }
+        else {
+            delta_s = ((double) (uint32_t) (timestamp_us - last_timestamp_us)) / 1000000.0;
+            altitude_reference_mm += speed_reference_mm_s * delta_s;
+            residual_mm = ((double) measured_altitude_mm) - altitude_reference_mm;
+            altitude_reference_mm += residual_mm * ((double) handle.alpha) / ((double) DPS310_ALTITUDE_GAIN_ONE);
+            speed_reference_mm_s += residual_mm * ((double) handle.beta) / (((double) DPS310_ALTITUDE_GAIN_ONE) * delta_s);
+        }
+        last_timestamp_us = timestamp_us;
+        if (fabs(((double) altitude_mm) - altitude_reference_mm) > altitude_error_max_mm) {
+            altitude_error_max_mm = fabs(((double) altitude_mm) - altitude_reference_mm);
+        }
+        if (fabs(((double) vertical_speed_mm_s) - speed_reference_mm_s) > speed_error_max_mm_s) {
+            speed_error_max_mm_s = fabs(((double) vertical_speed_mm_s) - speed_reference_mm_s);
+        }
+    }
+    failure = ((altitude_error_max_mm > DPS310_ALTITUDE_VALIDATION_FILTER_ALTITUDE_MM) || (speed_error_max_mm_s > DPS310_ALTITUDE_VALIDATION_FILTER_SPEED_MM_S)) ? 1 : 0;
+    printf("\nvertical speed filter (%u samples at 8 Hz): altitude error %.3f mm, speed error %.3f mm/s, final speed %d mm/s  %s\n", (unsigned int) DPS310_ALTITUDE_VALIDATION_FILTER_SAMPLES, altitude_error_max_mm, speed_error_max_mm_s, (int) vertical_speed_mm_s, (failure != 0) ? "FAILED" : "ok");
+errors:
+    if (status != DPS310_SUCCESS) {
+        printf("DPS310_ALTITUDE error 0x%04x (filter sample %u)\n", (unsigned int) status, (unsigned int) idx);
+        failure = 1;
+    }
+    return failure;
+}
+
+/*** DPS310 ALTITUDE VALIDATION main function ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    DPS310_ALTITUDE_VALIDATION_band_t* band = NULL;
+    double* pressure_power = NULL;
+    uint32_t failure_count = 0;
+    uint32_t number_of_pressures = 0;
+    int32_t pressure_step_q6 = 1;
+    int32_t pressure_q6 = 0;
+    int32_t reference_pa = 0;
+    uint32_t idx = 0;
+    uint8_t band_idx = 0;
+    // Optional pressure step (1 for all pressures in 1/64 Pa).
+    if (argc > 1) {
+        pressure_step_q6 = (int32_t) atoi(argv[1]);
+        if (pressure_step_q6 < 1) {
+            printf("Usage: %s [pressure_step_q6]\n", argv[0]);
+            return 2;
+        }
+    }
+    printf("DPS310 altitude validation against the floating-point formula (pressure step %d/64 Pa, reference step %d Pa)\n", (int) pressure_step_q6, (int) DPS310_ALTITUDE_VALIDATION_REFERENCE_STEP_PA);
+    printf("pressures over the whole supported range (%d to %d Pa), errors in mm\n\n", (int) DPS310_ALTITUDE_PRESSURE_MIN_PA, (int) DPS310_ALTITUDE_PRESSURE_MAX_PA);
+    // Powers of the measured pressures are shared by all reference pressures.
+    number_of_pressures = (uint32_t) ((DPS310_ALTITUDE_VALIDATION_PRESSURE_MAX_Q6 - DPS310_ALTITUDE_VALIDATION_PRESSURE_MIN_Q6) / pressure_step_q6 + 1);
+    pressure_power = (double*) malloc(number_of_pressures * sizeof(double));
+    if (pressure_power == NULL) {
+        printf("allocation error\n");
+        return 1;
+    }
+    idx = 0;
+    for (pressure_q6 = DPS310_ALTITUDE_VALIDATION_PRESSURE_MIN_Q6; pressure_q6 <= DPS310_ALTITUDE_VALIDATION_PRESSURE_MAX_Q6; pressure_q6 += pressure_step_q6) {
+        pressure_power[idx++] = pow(((double) pressure_q6) / 64.0, DPS310_ALTITUDE_VALIDATION_EXPONENT);
+    }
+    // Sweep reference pressures.
+    for (band_idx = 0; band_idx < (sizeof(dps310_altitude_validation_bands) / sizeof(DPS310_ALTITUDE_VALIDATION_band_t)); band_idx++) {
+        band = &(dps310_altitude_validation_bands[band_idx]);
+        for (reference_pa = band->reference_min_pa; reference_pa < band->reference_max_pa; reference_pa += DPS310_ALTITUDE_VALIDATION_REFERENCE_STEP_PA) {
+            failure_count += (uint32_t) _DPS310_ALTITUDE_VALIDATION_check_reference(reference_pa, pressure_step_q6, pressure_power, band);
+        }
+        if (band->reference_max_pa == DPS310_ALTITUDE_PRESSURE_MAX_PA) {
+            failure_count += (uint32_t) _DPS310_ALTITUDE_VALIDATION_check_reference((DPS310_ALTITUDE_PRESSURE_MAX_PA - 1), pressure_step_q6, pressure_power, band);
+        }
+    }
+    free(pressure_power);
+    // Report.
+    printf("%-14s %10s %10s %14s %14s  %s\n", "reference", "limit_mm", "error_mm", "reference_pa", "pressure_pa", "result");
+    for (band_idx = 0; band_idx < (sizeof(dps310_altitude_validation_bands) / sizeof(DPS310_ALTITUDE_VALIDATION_band_t)); band_idx++) {
+        band = &(dps310_altitude_validation_bands[band_idx]);
+        if (band->error_max_mm > band->error_limit_mm) {
+            failure_count++;
+        }
+        printf("%-14s %10.1f %10.3f %14d %14.3f  %s\n", band->name, band->error_limit_mm, band->error_max_mm, (int) band->error_max_reference_pa, ((double) band->error_max_pressure_q6) / 64.0, (band->error_max_mm > band->error_limit_mm) ? "FAILED" : "ok");
+    }
+    // Vertical speed filter arithmetic.
+    failure_count += (uint32_t) _DPS310_ALTITUDE_VALIDATION_check_filter();
+    return ((failure_count == 0) ? 0 : 1);
+}
@@ -0,0 +1,545 @@
+/*
+ * dps310_benchmark.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+// Required for clock_gettime() with strict C dialects.
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <stdio.h>
+#include <time.h>
+
+#include "dps310.h"
+#include "dps310_hw.h"
+#include "dps310_hw_simulator.h"
+#include "types.h"
+
+/*** DPS310 BENCHMARK local macros ***/
+
+#ifndef DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ
+#define DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ 400000
+#endif
+
+#define DPS310_BENCHMARK_SENSOR_ADDRESS_0           0x76
+#ifdef DPS310_DRIVER_STATIC_CONFIGURATION
+#define DPS310_BENCHMARK_SENSOR_ADDRESS_1           DPS310_DRIVER_STATIC_I2C_ADDRESS
+#else
+#define DPS310_BENCHMARK_SENSOR_ADDRESS_1           0x77
+#endif
+
+#define DPS310_BENCHMARK_POWER_ON_DELAY_MS          100
+#define DPS310_BENCHMARK_PROCESS_PERIOD_MS          1
+#define DPS310_BENCHMARK_STREAMING_DURATION_MS      2000
+#define DPS310_BENCHMARK_STREAMING_PERIOD_MS        10
+
+#define DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE    4096
+#define DPS310_BENCHMARK_COMPENSATION_ITERATIONS    256
+
+/*** DPS310 BENCHMARK local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char* name;
+    uint8_t registers[DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES];
+    DPS310_coefficients_t coefficients;
+} DPS310_BENCHMARK_coefficients_set_t;
+
+/*** DPS310 BENCHMARK local global variables ***/
+
+// Registers values written by hand from the datasheet layout and the coefficients they encode.
+static const DPS310_BENCHMARK_coefficients_set_t DPS310_BENCHMARK_COEFFICIENTS_SETS[] = {
+    { "coefficients decoding (typical)", { 0x0C, 0xCE, 0xFB, 0x13, 0xA5, 0x5F, 0x2A, 0x0F, 0xF4, 0xCA, 0x04, 0x75, 0xD8, 0xA9, 0x00, 0xBC, 0xFA, 0x7C },
+      { 204, -261, 80469, -54769, -2870, 1141, -10071, 188, -1412 } },
+    { "coefficients decoding (alternated extremes)", { 0x7F, 0xF8, 0x00, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF },
+      { 2047, -2048, -524288, 524287, 32767, -32768, 32767, -32768, 32767 } },
+};
+
+static DPS310_handle_t dps310_benchmark_handles[2];
+static uint32_t dps310_benchmark_failure_count = 0;
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+static uint32_t dps310_benchmark_notification_count = 0;
+#endif
+
+/*** DPS310 BENCHMARK local functions ***/
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_start(void) {
+    // Reset bus and driver counters.
+    DPS310_HW_SIMULATOR_reset_statistics();
+#ifdef DPS310_DRIVER_STATISTICS
+    DPS310_reset_statistics(&(dps310_benchmark_handles[0]));
+    DPS310_reset_statistics(&(dps310_benchmark_handles[1]));
+#endif
+}
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_report(const char* scenario, DPS310_status_t status, uint32_t number_of_calls) {
+    // Local variables.
+    DPS310_HW_SIMULATOR_statistics_t bus_statistics;
+#ifdef DPS310_DRIVER_STATISTICS
+    DPS310_statistics_t statistics;
+    uint32_t flag_poll_count = 0;
+    uint32_t delay_ms = 0;
+    uint8_t idx = 0;
+#endif
+    // Bus activity of all sensors.
+    DPS310_HW_SIMULATOR_get_statistics(&bus_statistics);
+    printf("%-44s %04X %6u %6u %6u", scenario, (unsigned int) status, (unsigned int) number_of_calls, (unsigned int) bus_statistics.i2c_transaction_count, (unsigned int) bus_statistics.i2c_byte_count);
+#ifdef DPS310_DRIVER_STATISTICS
+    // Driver activity of all sensors.
+    for (idx = 0; idx < 2; idx++) {
+        DPS310_get_statistics(&(dps310_benchmark_handles[idx]), &statistics);
+        flag_poll_count += statistics.flag_poll_count;
+        delay_ms += statistics.delay_ms;
+    }
+    printf(" %6u %8u", (unsigned int) flag_poll_count, (unsigned int) delay_ms);
+#else
+    printf(" %6s %8s", "-", "-");
+#endif
+    printf(" %10u\n", (unsigned int) bus_statistics.time_us);
+    if (status != DPS310_SUCCESS) {
+        dps310_benchmark_failure_count++;
+    }
+}
+
+#ifdef DPS310_DRIVER_STATISTICS
+/*******************************************************************/
+static void _DPS310_BENCHMARK_check_call_latency(const char* scenario, uint8_t handle_index, DPS310_statistics_call_t call) {
+    // Local variables.
+    DPS310_HW_SIMULATOR_statistics_t bus_statistics;
+    DPS310_statistics_t statistics;
+    // Single call of the scenario: its latency is the whole simulated time.
+    DPS310_HW_SIMULATOR_get_statistics(&bus_statistics);
+    DPS310_get_statistics(&(dps310_benchmark_handles[handle_index]), &statistics);
+    if ((statistics.calls[call].count != 1) || (statistics.calls[call].max_us != bus_statistics.time_us)) {
+        printf("%-44s latency statistics %u calls, %u us (expected 1 call, %u us)\n", scenario, (unsigned int) statistics.calls[call].count, (unsigned int) statistics.calls[call].max_us, (unsigned int) bus_statistics.time_us);
+        dps310_benchmark_failure_count++;
+    }
+}
+#endif
+
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+/*******************************************************************/
+static void _DPS310_BENCHMARK_notification_callback(void) {
+    // Count user notifications.
+    dps310_benchmark_notification_count++;
+}
+#endif
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_blocking_measurements(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t* handle = &(dps310_benchmark_handles[1]);
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    DPS310_configuration_t configuration;
+    uint8_t idx = 0;
+#endif
+    // Probe, coefficients and registers configuration.
+    _DPS310_BENCHMARK_start();
+    status = DPS310_init_sensor(handle, 0, DPS310_BENCHMARK_SENSOR_ADDRESS_1, NULL);
+    _DPS310_BENCHMARK_report("init_sensor (power-on)", status, 1);
+#ifdef DPS310_DRIVER_STATISTICS
+    _DPS310_BENCHMARK_check_call_latency("init_sensor (power-on)", 1, DPS310_STATISTICS_CALL_INIT_SENSOR);
+#endif
+    // Ready sensor.
+    _DPS310_BENCHMARK_start();
+    status = DPS310_get_pressure_temperature(handle, &pressure, &temperature);
+    _DPS310_BENCHMARK_report("get_pressure_temperature", status, 1);
+    // Same measurement with separate write and read transactions.
+    DPS310_HW_SIMULATOR_set_write_read_split(1);
+    _DPS310_BENCHMARK_start();
+    status = DPS310_get_pressure_temperature(handle, &pressure, &temperature);
+    _DPS310_BENCHMARK_report("get_pressure_temperature (split write-read)", status, 1);
+    DPS310_HW_SIMULATOR_set_write_read_split(0);
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    // Temperature measured once every 4 pressure measurements.
+    configuration = handle->configuration;
+    configuration.temperature_period = 4;
+    DPS310_set_configuration(handle, &configuration);
+    _DPS310_BENCHMARK_start();
+    for (idx = 0; idx < 4; idx++) {
+        status = DPS310_get_pressure_temperature(handle, &pressure, &temperature);
+        if (status != DPS310_SUCCESS) break;
+    }
+    _DPS310_BENCHMARK_report("get_pressure_temperature (period 4) x4", status, idx);
+    configuration.temperature_period = 1;
+    DPS310_set_configuration(handle, &configuration);
+#endif
+    printf("%-44s pressure %d temperature %d\n", "  last result", (int) pressure, (int) temperature);
+}
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_non_blocking_measurement(const char* scenario) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t* handle = &(dps310_benchmark_handles[1]);
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    uint8_t measurement_done_flag = 0;
+    uint32_t number_of_calls = 0;
+    // Advance the state machine once per period until completion.
+    _DPS310_BENCHMARK_start();
+    status = DPS310_start_measurement(handle, NULL);
+    while ((status == DPS310_SUCCESS) && (measurement_done_flag == 0)) {
+        status = DPS310_process(handle);
+        number_of_calls++;
+        if (status != DPS310_SUCCESS) break;
+        status = DPS310_read_measurement(handle, &pressure, &temperature, &measurement_done_flag);
+        if ((status != DPS310_SUCCESS) || (measurement_done_flag != 0)) break;
+        status = DPS310_HW_delay_milliseconds(DPS310_BENCHMARK_PROCESS_PERIOD_MS);
+    }
+    _DPS310_BENCHMARK_report(scenario, status, number_of_calls);
+}
+
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+/*******************************************************************/
+static void _DPS310_BENCHMARK_multiple_measurements(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_measurement_t measurements[2];
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    // Overlapped conversions of both sensors.
+    _DPS310_BENCHMARK_start();
+    status = DPS310_get_pressure_temperature_multiple(dps310_benchmark_handles, 2, measurements);
+    if (status == DPS310_SUCCESS) {
+        status = (measurements[0].status != DPS310_SUCCESS) ? measurements[0].status : measurements[1].status;
+    }
+    _DPS310_BENCHMARK_report("get_pressure_temperature_multiple (2)", status, 1);
+#ifdef DPS310_DRIVER_STATISTICS
+    _DPS310_BENCHMARK_check_call_latency("get_pressure_temperature_multiple (2)", 0, DPS310_STATISTICS_CALL_GET_PRESSURE_TEMPERATURE_MULTIPLE);
+    _DPS310_BENCHMARK_check_call_latency("get_pressure_temperature_multiple (2)", 1, DPS310_STATISTICS_CALL_GET_PRESSURE_TEMPERATURE_MULTIPLE);
+#endif
+    // Sequential conversions.
+    _DPS310_BENCHMARK_start();
+    status = DPS310_get_pressure_temperature(&(dps310_benchmark_handles[0]), &pressure, &temperature);
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_get_pressure_temperature(&(dps310_benchmark_handles[1]), &pressure, &temperature);
+    }
+    _DPS310_BENCHMARK_report("get_pressure_temperature x2 (sequential)", status, 2);
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_BENCHMARK_power_cycle(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Power on simulated sensors again and reset both handles.
+    status = DPS310_de_init();
+    if (status != DPS310_SUCCESS) goto errors;
+    status = DPS310_init();
+    if (status != DPS310_SUCCESS) goto errors;
+    DPS310_init_handle(&(dps310_benchmark_handles[0]), 0, DPS310_BENCHMARK_SENSOR_ADDRESS_0);
+    DPS310_init_handle(&(dps310_benchmark_handles[1]), 0, DPS310_BENCHMARK_SENSOR_ADDRESS_1);
+errors:
+    return status;
+}
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_calibration(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_HW_SIMULATOR_statistics_t lazy_statistics;
+    DPS310_HW_SIMULATOR_statistics_t import_statistics;
+    uint8_t calibration_blob[DPS310_CALIBRATION_BLOB_SIZE_BYTES];
+    uint8_t corrupted_blob[DPS310_CALIBRATION_BLOB_SIZE_BYTES];
+    uint8_t calibration_valid_flag = 0;
+    int32_t lazy_pressure = 0;
+    int32_t lazy_temperature = 0;
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    uint8_t idx = 0;
+    // Export from the first sensor.
+    _DPS310_BENCHMARK_start();
+    status = DPS310_export_calibration(&(dps310_benchmark_handles[1]), calibration_blob);
+    _DPS310_BENCHMARK_report("export_calibration", status, 1);
+    if (status != DPS310_SUCCESS) return;
+    // First measurement after power-on, coefficients read from the sensor.
+    status = _DPS310_BENCHMARK_power_cycle();
+    _DPS310_BENCHMARK_start();
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_get_pressure_temperature(&(dps310_benchmark_handles[1]), &lazy_pressure, &lazy_temperature);
+    }
+    _DPS310_BENCHMARK_report("get_pressure_temperature (cold boot)", status, 1);
+    DPS310_HW_SIMULATOR_get_statistics(&lazy_statistics);
+    // First measurement after power-on, coefficients imported.
+    status = _DPS310_BENCHMARK_power_cycle();
+    _DPS310_BENCHMARK_start();
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_import_calibration(&(dps310_benchmark_handles[1]), calibration_blob, &calibration_valid_flag);
+    }
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_get_pressure_temperature(&(dps310_benchmark_handles[1]), &pressure, &temperature);
+    }
+    _DPS310_BENCHMARK_report("import_calibration + get (cold boot)", status, 2);
+    DPS310_HW_SIMULATOR_get_statistics(&import_statistics);
+    if (calibration_valid_flag == 0) {
+        printf("%-44s blob rejected\n", "");
+        dps310_benchmark_failure_count++;
+    }
+    if ((pressure != lazy_pressure) || (temperature != lazy_temperature)) {
+        printf("%-44s result differs from coefficients read\n", "");
+        dps310_benchmark_failure_count++;
+    }
+    if ((import_statistics.time_us >= lazy_statistics.time_us) || (import_statistics.i2c_byte_count >= lazy_statistics.i2c_byte_count)) {
+        printf("%-44s import slower than coefficients read\n", "");
+        dps310_benchmark_failure_count++;
+    }
+    // Corrupted blob must be rejected.
+    for (idx = 0; idx < DPS310_CALIBRATION_BLOB_SIZE_BYTES; idx++) {
+        corrupted_blob[idx] = calibration_blob[idx];
+    }
+    corrupted_blob[DPS310_CALIBRATION_BLOB_SIZE_BYTES >> 1] ^= 0x01;
+    DPS310_init_handle(&(dps310_benchmark_handles[1]), 0, DPS310_BENCHMARK_SENSOR_ADDRESS_1);
+    _DPS310_BENCHMARK_start();
+    status = DPS310_import_calibration(&(dps310_benchmark_handles[1]), corrupted_blob, &calibration_valid_flag);
+    _DPS310_BENCHMARK_report("import_calibration (corrupted blob)", status, 1);
+    if (calibration_valid_flag != 0) {
+        printf("%-44s blob accepted\n", "");
+        dps310_benchmark_failure_count++;
+    }
+    // Leave a ready sensor with known coefficients for the next scenarios.
+    DPS310_import_calibration(&(dps310_benchmark_handles[1]), calibration_blob, &calibration_valid_flag);
+    DPS310_HW_delay_milliseconds(DPS310_BENCHMARK_POWER_ON_DELAY_MS);
+}
+#endif
+
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+/*******************************************************************/
+static void _DPS310_BENCHMARK_interrupt_measurements(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t* handle = &(dps310_benchmark_handles[1]);
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    // Data ready interrupts.
+    status = DPS310_enable_interrupt(handle, (DPS310_INTERRUPT_PRESSURE | DPS310_INTERRUPT_TEMPERATURE), &_DPS310_BENCHMARK_notification_callback);
+    if (status != DPS310_SUCCESS) goto errors;
+    _DPS310_BENCHMARK_start();
+    status = DPS310_get_pressure_temperature(handle, &pressure, &temperature);
+    _DPS310_BENCHMARK_report("get_pressure_temperature (interrupt)", status, 1);
+    _DPS310_BENCHMARK_non_blocking_measurement("start_measurement + process (interrupt)");
+errors:
+    status = DPS310_disable_interrupt(handle);
+    if (status != DPS310_SUCCESS) {
+        _DPS310_BENCHMARK_report("disable_interrupt", status, 1);
+    }
+}
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_interrupt_refusal(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t* handle = &(dps310_benchmark_handles[1]);
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    // A refused interrupt mode must leave the handle in polling mode (without any disable call).
+    DPS310_HW_SIMULATOR_set_interrupt_lines(0);
+    status = DPS310_enable_interrupt(handle, (DPS310_INTERRUPT_PRESSURE | DPS310_INTERRUPT_TEMPERATURE | DPS310_INTERRUPT_FIFO_FULL), &_DPS310_BENCHMARK_notification_callback);
+    DPS310_HW_SIMULATOR_set_interrupt_lines(1);
+    if (status != DPS310_ERROR_INTERRUPT) {
+        _DPS310_BENCHMARK_report("enable_interrupt (no interrupt line)", status, 1);
+        dps310_benchmark_failure_count++;
+        return;
+    }
+    _DPS310_BENCHMARK_start();
+    status = DPS310_get_pressure_temperature(handle, &pressure, &temperature);
+    _DPS310_BENCHMARK_report("get_pressure_temperature (interrupt refused)", status, 1);
+    _DPS310_BENCHMARK_non_blocking_measurement("start_measurement + process (int. refused)");
+}
+#endif
+
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+/*******************************************************************/
+static void _DPS310_BENCHMARK_streaming(const char* scenario, uint8_t interrupt_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t* handle = &(dps310_benchmark_handles[1]);
+    DPS310_fifo_sample_t samples[32];
+    uint8_t number_of_samples = 0;
+    uint8_t fifo_full_flag = 0;
+    uint32_t total_number_of_samples = 0;
+    uint32_t number_of_calls = 0;
+    uint32_t time_ms = 0;
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    DPS310_configuration_t configuration = handle->configuration;
+    // 32 Hz pressure and 1 Hz temperature.
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_32HZ;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    status = DPS310_set_configuration(handle, &configuration);
+    if (status != DPS310_SUCCESS) goto errors;
+#endif
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    if (interrupt_flag != 0) {
+        status = DPS310_enable_interrupt(handle, DPS310_INTERRUPT_FIFO_FULL, &_DPS310_BENCHMARK_notification_callback);
+        if (status != DPS310_SUCCESS) goto errors;
+    }
+#else
+    UNUSED(interrupt_flag);
+#endif
+    status = DPS310_start_streaming(handle);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Read FIFO periodically.
+    _DPS310_BENCHMARK_start();
+    for (time_ms = 0; time_ms < DPS310_BENCHMARK_STREAMING_DURATION_MS; time_ms += DPS310_BENCHMARK_STREAMING_PERIOD_MS) {
+        status = DPS310_HW_delay_milliseconds(DPS310_BENCHMARK_STREAMING_PERIOD_MS);
+        if (status != DPS310_SUCCESS) goto errors;
+        status = DPS310_read_fifo(handle, samples, 32, &number_of_samples, &fifo_full_flag);
+        number_of_calls++;
+        if (status != DPS310_SUCCESS) goto errors;
+        total_number_of_samples += number_of_samples;
+    }
+errors:
+    _DPS310_BENCHMARK_report(scenario, status, number_of_calls);
+    printf("%-44s %u FIFO entries\n", "", (unsigned int) total_number_of_samples);
+    DPS310_stop_streaming(handle);
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    if (interrupt_flag != 0) {
+        DPS310_disable_interrupt(handle);
+    }
+#endif
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    DPS310_set_configuration(handle, &configuration);
+#endif
+}
+#endif
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_compensation(void) {
+    // Local variables.
+    static int32_t prs_raw[DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE];
+    static int32_t tmp_raw[DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE];
+    static int32_t pressure[DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE];
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_coefficients_t coefficients;
+    DPS310_configuration_t configuration;
+    struct timespec start;
+    struct timespec end;
+    double elapsed_ns = 0.0;
+    double number_of_samples = 0.0;
+    int64_t checksum = 0;
+    uint32_t idx = 0;
+    // Realistic inputs around the simulator default values.
+    status = DPS310_get_coefficients(&(dps310_benchmark_handles[1]), &coefficients);
+    if (status != DPS310_SUCCESS) goto errors;
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.pressure_oversampling = DPS310_OVERSAMPLING_2;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.temperature_oversampling = DPS310_OVERSAMPLING_1;
+    configuration.pressure_unit = DPS310_PRESSURE_UNIT_PA_Q6;
+    configuration.temperature_unit = DPS310_TEMPERATURE_UNIT_CENTI_DEGREES;
+    configuration.temperature_period = 1;
+    for (idx = 0; idx < DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE; idx++) {
+        prs_raw[idx] = (int32_t) (-600000 + (int32_t) (idx * 37));
+        tmp_raw[idx] = (int32_t) (154700 + (int32_t) (idx & 0xFF));
+    }
+    // Host time of the pressure compensation only.
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (idx = 0; idx < DPS310_BENCHMARK_COMPENSATION_ITERATIONS; idx++) {
+        status = DPS310_compensate(&coefficients, &configuration, prs_raw, tmp_raw, pressure, NULL, DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE);
+        if (status != DPS310_SUCCESS) goto errors;
+        checksum += pressure[idx];
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    elapsed_ns = ((double) (end.tv_sec - start.tv_sec) * 1e9) + (double) (end.tv_nsec - start.tv_nsec);
+    number_of_samples = (double) DPS310_BENCHMARK_COMPENSATION_BLOCK_SIZE * (double) DPS310_BENCHMARK_COMPENSATION_ITERATIONS;
+    printf("%-44s %.2f ns/sample, %.1f Msamples/s (host, checksum %lld)\n", "compensate (pressure, Pa Q6)", (elapsed_ns / number_of_samples), ((number_of_samples * 1e3) / elapsed_ns), (long long) checksum);
+errors:
+    if (status != DPS310_SUCCESS) {
+        _DPS310_BENCHMARK_report("compensate", status, 1);
+    }
+}
+
+/*******************************************************************/
+static uint8_t _DPS310_BENCHMARK_check_coefficients(const char* scenario, const DPS310_coefficients_t* expected) {
+    // Local variables.
+    DPS310_coefficients_t coefficients;
+    uint8_t match_flag = 0;
+    // Coefficients decoded by the driver.
+    if (DPS310_get_coefficients(&(dps310_benchmark_handles[1]), &coefficients) == DPS310_SUCCESS) {
+        match_flag = ((coefficients.c0 == expected->c0) && (coefficients.c1 == expected->c1) && (coefficients.c00 == expected->c00) && (coefficients.c10 == expected->c10) &&
+                      (coefficients.c01 == expected->c01) && (coefficients.c11 == expected->c11) && (coefficients.c20 == expected->c20) && (coefficients.c21 == expected->c21) &&
+                      (coefficients.c30 == expected->c30)) ? 1 : 0;
+    }
+    if (match_flag == 0) {
+        printf("%-44s decoded %d %d %d %d %d %d %d %d %d\n", scenario, (int) coefficients.c0, (int) coefficients.c1, (int) coefficients.c00, (int) coefficients.c10, (int) coefficients.c01,
+               (int) coefficients.c11, (int) coefficients.c20, (int) coefficients.c21, (int) coefficients.c30);
+        dps310_benchmark_failure_count++;
+    }
+    return match_flag;
+}
+
+/*******************************************************************/
+static void _DPS310_BENCHMARK_coefficients(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    uint8_t registers[DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES];
+    uint8_t set_idx = 0;
+    uint8_t idx = 0;
+    // Simulator default registers, decoded at power-on.
+    _DPS310_BENCHMARK_check_coefficients("coefficients decoding (simulator default)", &(DPS310_BENCHMARK_COEFFICIENTS_SETS[0].coefficients));
+    // Programmed registers, decoded by a new init.
+    for (set_idx = 0; set_idx < (sizeof(DPS310_BENCHMARK_COEFFICIENTS_SETS) / sizeof(DPS310_BENCHMARK_coefficients_set_t)); set_idx++) {
+        for (idx = 0; idx < DPS310_HW_SIMULATOR_COEFFICIENTS_SIZE_BYTES; idx++) {
+            registers[idx] = DPS310_BENCHMARK_COEFFICIENTS_SETS[set_idx].registers[idx];
+        }
+        _DPS310_BENCHMARK_start();
+        status = DPS310_HW_SIMULATOR_set_coefficients_registers(DPS310_BENCHMARK_SENSOR_ADDRESS_1, registers);
+        if (status == DPS310_SUCCESS) {
+            status = DPS310_init_sensor(&(dps310_benchmark_handles[1]), 0, DPS310_BENCHMARK_SENSOR_ADDRESS_1, NULL);
+        }
+        _DPS310_BENCHMARK_report(DPS310_BENCHMARK_COEFFICIENTS_SETS[set_idx].name, status, 1);
+        _DPS310_BENCHMARK_check_coefficients(DPS310_BENCHMARK_COEFFICIENTS_SETS[set_idx].name, &(DPS310_BENCHMARK_COEFFICIENTS_SETS[set_idx].coefficients));
+    }
+}
+
+/*** DPS310 BENCHMARK main function ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Build description.
+    printf("DPS310 simulator benchmark (I2C %u Hz)\n", (unsigned int) DPS310_DRIVER_HW_SIMULATOR_I2C_FREQUENCY_HZ);
+    printf("sizeof(DPS310_handle_t) = %u bytes\n\n", (unsigned int) sizeof(DPS310_handle_t));
+    printf("%-44s %4s %6s %6s %6s %6s %8s %10s\n", "scenario", "stat", "calls", "i2c", "bytes", "polls", "delay_ms", "latency_us");
+    // Init driver and simulated sensors.
+    status = DPS310_init();
+    if (status != DPS310_SUCCESS) goto errors;
+    DPS310_init_handle(&(dps310_benchmark_handles[0]), 0, DPS310_BENCHMARK_SENSOR_ADDRESS_0);
+    DPS310_init_handle(&(dps310_benchmark_handles[1]), 0, DPS310_BENCHMARK_SENSOR_ADDRESS_1);
+    // Scenarios.
+    _DPS310_BENCHMARK_blocking_measurements();
+    _DPS310_BENCHMARK_non_blocking_measurement("start_measurement + process");
+#ifndef DPS310_DRIVER_STATIC_CONFIGURATION
+    DPS310_HW_delay_milliseconds(DPS310_BENCHMARK_POWER_ON_DELAY_MS);
+    _DPS310_BENCHMARK_multiple_measurements();
+    _DPS310_BENCHMARK_calibration();
+#endif
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    _DPS310_BENCHMARK_interrupt_measurements();
+    _DPS310_BENCHMARK_interrupt_refusal();
+#endif
+#ifndef DPS310_DRIVER_DISABLE_FIFO
+    _DPS310_BENCHMARK_streaming("streaming (FIFO polled every 10 ms, 2 s)", 0);
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    _DPS310_BENCHMARK_streaming("streaming (FIFO full interrupt, 2 s)", 1);
+#endif
+#endif
+    _DPS310_BENCHMARK_compensation();
+    _DPS310_BENCHMARK_coefficients();
+    status = DPS310_de_init();
+errors:
+    if ((status != DPS310_SUCCESS) || (dps310_benchmark_failure_count != 0)) {
+        printf("\nFAILED (status %04X, %u failed scenarios)\n", (unsigned int) status, (unsigned int) dps310_benchmark_failure_count);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,277 @@
+/*
+ * dps310_filter_test.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+
+#include "dps310.h"
+#include "dps310_hw.h"
+#include "dps310_hw_simulator.h"
+#include "types.h"
+
+/*** DPS310 FILTER TEST local macros ***/
+
+#if !(defined DPS310_DRIVER_FILTER) || !(defined DPS310_DRIVER_SAMPLE_BUFFER_SIZE)
+#error "DPS310 filter test: DPS310_DRIVER_FILTER and DPS310_DRIVER_SAMPLE_BUFFER_SIZE must be defined"
+#endif
+
+#define DPS310_FILTER_TEST_SENSOR_ADDRESS           0x77
+
+#define DPS310_FILTER_TEST_PRESSURE_PA              100000
+#define DPS310_FILTER_TEST_STEP_PA                  1000
+#define DPS310_FILTER_TEST_SPIKE_PA                 5000
+#define DPS310_FILTER_TEST_NOISE_PA                 16
+
+#define DPS310_FILTER_TEST_STEP_SAMPLES             64
+#define DPS310_FILTER_TEST_SPIKE_SAMPLES            64
+#define DPS310_FILTER_TEST_KALMAN_SAMPLES           2048
+
+// Simulated streaming duration (32 Hz pressure).
+#define DPS310_FILTER_TEST_STREAMING_DURATION_MS    500
+
+/*** DPS310 FILTER TEST local global variables ***/
+
+static DPS310_handle_t dps310_filter_test_handle;
+static uint32_t dps310_filter_test_failure_count = 0;
+static uint32_t dps310_filter_test_noise_seed = 1;
+
+/*** DPS310 FILTER TEST local functions ***/
+
+/*******************************************************************/
+static void _DPS310_FILTER_TEST_check(const char* test, uint8_t condition) {
+    // Print result.
+    printf("%-52s %s\n", test, (condition != 0) ? "ok" : "FAILED");
+    if (condition == 0) {
+        dps310_filter_test_failure_count++;
+    }
+}
+
+/*******************************************************************/
+static int32_t _DPS310_FILTER_TEST_noise(void) {
+    // Deterministic uniform noise (linear congruential generator).
+    dps310_filter_test_noise_seed = (dps310_filter_test_noise_seed * 1103515245) + 12345;
+    return (int32_t) ((dps310_filter_test_noise_seed >> 16) % ((DPS310_FILTER_TEST_NOISE_PA << 1) + 1)) - DPS310_FILTER_TEST_NOISE_PA;
+}
+
+/*******************************************************************/
+static DPS310_status_t _DPS310_FILTER_TEST_configure(uint8_t stages_mask, uint8_t median_size) {
+    // Local variables.
+    DPS310_filter_configuration_t filter_configuration = dps310_filter_test_handle.filter_configuration;
+    // Default gains and variances, selected stages only.
+    filter_configuration.stages_mask = stages_mask;
+    filter_configuration.median_size = median_size;
+    return DPS310_set_filter_configuration(&dps310_filter_test_handle, &filter_configuration);
+}
+
+/*******************************************************************/
+static void _DPS310_FILTER_TEST_step_response(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    int32_t pressure[DPS310_FILTER_TEST_STEP_SAMPLES];
+    double expected = 0.0;
+    double error = 0.0;
+    double error_max = 0.0;
+    uint8_t monotonic_flag = 1;
+    uint32_t idx = 0;
+    // IIR low-pass with the default 0.25 weight: y(n) = step * (1 - 0.75^n).
+    status = _DPS310_FILTER_TEST_configure(DPS310_FILTER_STAGE_IIR, 1);
+    _DPS310_FILTER_TEST_check("IIR stage configuration", (status == DPS310_SUCCESS));
+    pressure[0] = DPS310_FILTER_TEST_PRESSURE_PA;
+    for (idx = 1; idx < DPS310_FILTER_TEST_STEP_SAMPLES; idx++) {
+        pressure[idx] = (DPS310_FILTER_TEST_PRESSURE_PA + DPS310_FILTER_TEST_STEP_PA);
+    }
+    status = DPS310_filter_pressure(&dps310_filter_test_handle, pressure, DPS310_FILTER_TEST_STEP_SAMPLES);
+    _DPS310_FILTER_TEST_check("DPS310_filter_pressure()", (status == DPS310_SUCCESS));
+    expected = (double) DPS310_FILTER_TEST_STEP_PA;
+    for (idx = 1; idx < DPS310_FILTER_TEST_STEP_SAMPLES; idx++) {
+        expected *= 0.75;
+        error = (double) (pressure[idx] - (DPS310_FILTER_TEST_PRESSURE_PA + DPS310_FILTER_TEST_STEP_PA)) + expected;
+        error = (error < 0.0) ? (-error) : error;
+        if (error > error_max) {
+            error_max = error;
+        }
+        if ((pressure[idx] < pressure[idx - 1]) || (pressure[idx] > (DPS310_FILTER_TEST_PRESSURE_PA + DPS310_FILTER_TEST_STEP_PA))) {
+            monotonic_flag = 0;
+        }
+    }
+    printf("%-52s error max %.3f Pa, last output %d Pa\n", "  IIR step response", error_max, (int) pressure[DPS310_FILTER_TEST_STEP_SAMPLES - 1]);
+    _DPS310_FILTER_TEST_check("step response follows 1 - 0.75^n within 1 Pa", (error_max <= 1.0));
+    _DPS310_FILTER_TEST_check("step response without overshoot", (monotonic_flag != 0));
+    _DPS310_FILTER_TEST_check("step response settled", (pressure[DPS310_FILTER_TEST_STEP_SAMPLES - 1] == (DPS310_FILTER_TEST_PRESSURE_PA + DPS310_FILTER_TEST_STEP_PA)));
+}
+
+/*******************************************************************/
+static void _DPS310_FILTER_TEST_spike_rejection(uint8_t median_size, uint8_t burst_length) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    int32_t pressure[DPS310_FILTER_TEST_SPIKE_SAMPLES];
+    char test[64];
+    uint32_t rejected_count = 0;
+    uint32_t idx = 0;
+    // Constant pressure with alternated positive and negative bursts every 8 samples.
+    status = _DPS310_FILTER_TEST_configure(DPS310_FILTER_STAGE_MEDIAN, median_size);
+    for (idx = 0; idx < DPS310_FILTER_TEST_SPIKE_SAMPLES; idx++) {
+        pressure[idx] = DPS310_FILTER_TEST_PRESSURE_PA;
+        if (((idx & 0x07) >= 4) && ((idx & 0x07) < (uint32_t) (4 + burst_length))) {
+            pressure[idx] += ((idx & 0x08) != 0) ? DPS310_FILTER_TEST_SPIKE_PA : (-DPS310_FILTER_TEST_SPIKE_PA);
+        }
+    }
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_filter_pressure(&dps310_filter_test_handle, pressure, DPS310_FILTER_TEST_SPIKE_SAMPLES);
+    }
+    for (idx = 0; idx < DPS310_FILTER_TEST_SPIKE_SAMPLES; idx++) {
+        if (pressure[idx] == DPS310_FILTER_TEST_PRESSURE_PA) {
+            rejected_count++;
+        }
+    }
+    sprintf(test, "median %u rejects bursts of %u samples", (unsigned int) median_size, (unsigned int) burst_length);
+    _DPS310_FILTER_TEST_check(test, ((status == DPS310_SUCCESS) && (rejected_count == DPS310_FILTER_TEST_SPIKE_SAMPLES)));
+}
+
+/*******************************************************************/
+static void _DPS310_FILTER_TEST_kalman_convergence(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_filter_configuration_t* filter_configuration = &(dps310_filter_test_handle.filter_configuration);
+    int32_t pressure[DPS310_FILTER_TEST_KALMAN_SAMPLES];
+    double covariance = 0.0;
+    double gain = 0.0;
+    double input_power = 0.0;
+    double output_power = 0.0;
+    double expected_ratio = 0.0;
+    double ratio = 0.0;
+    double error = 0.0;
+    uint32_t idx = 0;
+    // Constant pressure with uniform noise.
+    status = _DPS310_FILTER_TEST_configure(DPS310_FILTER_STAGE_KALMAN, 1);
+    _DPS310_FILTER_TEST_check("Kalman stage configuration", (status == DPS310_SUCCESS));
+    for (idx = 0; idx < DPS310_FILTER_TEST_KALMAN_SAMPLES; idx++) {
+        pressure[idx] = DPS310_FILTER_TEST_PRESSURE_PA + _DPS310_FILTER_TEST_noise();
+        error = (double) (pressure[idx] - DPS310_FILTER_TEST_PRESSURE_PA);
+        input_power += (idx >= (DPS310_FILTER_TEST_KALMAN_SAMPLES >> 1)) ? (error * error) : 0.0;
+    }
+    status = DPS310_filter_pressure(&dps310_filter_test_handle, pressure, DPS310_FILTER_TEST_KALMAN_SAMPLES);
+    _DPS310_FILTER_TEST_check("DPS310_filter_pressure()", (status == DPS310_SUCCESS));
+    // Floating-point covariance recursion with the same initial value (measurement variance).
+    covariance = (double) filter_configuration->kalman_measurement_variance;
+    for (idx = 1; idx < DPS310_FILTER_TEST_KALMAN_SAMPLES; idx++) {
+        covariance += (double) filter_configuration->kalman_process_variance;
+        gain = covariance / (covariance + (double) filter_configuration->kalman_measurement_variance);
+        covariance *= (1.0 - gain);
+    }
+    error = ((double) dps310_filter_test_handle.filter_kalman_covariance) - covariance;
+    printf("%-52s covariance %u (floating-point %.1f), gain %.4f\n", "  Kalman steady state", (unsigned int) dps310_filter_test_handle.filter_kalman_covariance, covariance, gain);
+    _DPS310_FILTER_TEST_check("gain computed only until the covariance is constant", (dps310_filter_test_handle.filter_kalman_steady_flag != 0));
+    _DPS310_FILTER_TEST_check("covariance converges to the steady state", ((error <= 2.0) && (error >= -2.0)));
+    // Steady state filter is a first order low-pass of weight K: output noise power is K / (2 - K) of the input one.
+    for (idx = (DPS310_FILTER_TEST_KALMAN_SAMPLES >> 1); idx < DPS310_FILTER_TEST_KALMAN_SAMPLES; idx++) {
+        error = (double) (pressure[idx] - DPS310_FILTER_TEST_PRESSURE_PA);
+        output_power += (error * error);
+    }
+    expected_ratio = gain / (2.0 - gain);
+    ratio = output_power / input_power;
+    printf("%-52s noise power ratio %.4f (expected %.4f)\n", "  Kalman noise reduction", ratio, expected_ratio);
+    _DPS310_FILTER_TEST_check("noise reduced as expected from the gain", (ratio <= (2.0 * expected_ratio)));
+    printf("%-52s last output %d Pa\n", "  Kalman output", (int) pressure[DPS310_FILTER_TEST_KALMAN_SAMPLES - 1]);
+    _DPS310_FILTER_TEST_check("output converges to the mean", ((pressure[DPS310_FILTER_TEST_KALMAN_SAMPLES - 1] - DPS310_FILTER_TEST_PRESSURE_PA) <= 2) && ((pressure[DPS310_FILTER_TEST_KALMAN_SAMPLES - 1] - DPS310_FILTER_TEST_PRESSURE_PA) >= -2));
+}
+
+/*******************************************************************/
+static void _DPS310_FILTER_TEST_fifo(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_fifo_sample_t samples[5] = { { DPS310_FIFO_SAMPLE_TYPE_PRESSURE, DPS310_FILTER_TEST_PRESSURE_PA }, { DPS310_FIFO_SAMPLE_TYPE_PRESSURE, DPS310_FILTER_TEST_PRESSURE_PA }, { DPS310_FIFO_SAMPLE_TYPE_TEMPERATURE, 25 }, { DPS310_FIFO_SAMPLE_TYPE_PRESSURE, (DPS310_FILTER_TEST_PRESSURE_PA + DPS310_FILTER_TEST_SPIKE_PA) }, { DPS310_FIFO_SAMPLE_TYPE_PRESSURE, DPS310_FILTER_TEST_PRESSURE_PA } };
+    // Spike of a FIFO batch once the median window is full, temperature entry in between.
+    status = _DPS310_FILTER_TEST_configure(DPS310_FILTER_STAGE_MEDIAN, 3);
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_filter_fifo(&dps310_filter_test_handle, samples, 5);
+    }
+    _DPS310_FILTER_TEST_check("FIFO batch filtered, temperature entry unchanged", ((status == DPS310_SUCCESS) && (samples[2].value == 25) && (samples[3].value == DPS310_FILTER_TEST_PRESSURE_PA) && (samples[4].value == DPS310_FILTER_TEST_PRESSURE_PA)));
+}
+
+/*******************************************************************/
+static void _DPS310_FILTER_TEST_sample_buffer(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t* handle = &dps310_filter_test_handle;
+    DPS310_configuration_t configuration;
+    DPS310_sample_t samples[DPS310_DRIVER_SAMPLE_BUFFER_SIZE];
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    uint32_t number_of_popped_samples = 0;
+    uint32_t sample_buffer_overrun_count = 0;
+    uint32_t fifo_overrun_count = 0;
+    uint8_t number_of_samples = 0;
+    uint8_t measurement_done_flag = 0;
+    uint8_t period_flag = 1;
+    uint32_t idx = 0;
+    // Non-blocking measurement.
+    status = DPS310_init_sensor(handle, 0, DPS310_FILTER_TEST_SENSOR_ADDRESS, NULL);
+    _DPS310_FILTER_TEST_check("DPS310_init_sensor()", (status == DPS310_SUCCESS));
+    status = DPS310_start_measurement(handle, NULL);
+    while ((status == DPS310_SUCCESS) && (measurement_done_flag == 0)) {
+        status = DPS310_process(handle);
+        if (status != DPS310_SUCCESS) break;
+        status = DPS310_read_measurement(handle, &pressure, &temperature, &measurement_done_flag);
+        if ((status != DPS310_SUCCESS) || (measurement_done_flag != 0)) break;
+        status = DPS310_HW_delay_milliseconds(1);
+    }
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_pop_samples(handle, samples, DPS310_DRIVER_SAMPLE_BUFFER_SIZE, &number_of_popped_samples);
+    }
+    _DPS310_FILTER_TEST_check("non-blocking measurement pushed in the buffer", ((status == DPS310_SUCCESS) && (number_of_popped_samples == 1) && (samples[0].pressure == pressure) && (samples[0].temperature == temperature)));
+    // Streaming at 32 Hz: the FIFO holds more pressure samples than the buffer.
+    configuration = handle->configuration;
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_32HZ;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    status = DPS310_set_configuration(handle, &configuration);
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_start_streaming(handle);
+    }
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_HW_delay_milliseconds(DPS310_FILTER_TEST_STREAMING_DURATION_MS);
+    }
+    if (status == DPS310_SUCCESS) {
+        status = DPS310_acquire_fifo(handle, &number_of_samples);
+    }
+    DPS310_stop_streaming(handle);
+    _DPS310_FILTER_TEST_check("DPS310_acquire_fifo()", ((status == DPS310_SUCCESS) && (number_of_samples == DPS310_DRIVER_SAMPLE_BUFFER_SIZE)));
+    status = DPS310_pop_samples(handle, samples, DPS310_DRIVER_SAMPLE_BUFFER_SIZE, &number_of_popped_samples);
+    for (idx = 1; idx < number_of_popped_samples; idx++) {
+        if ((samples[idx].timestamp_us - samples[idx - 1].timestamp_us) != (1000000 >> DPS310_MEASUREMENT_RATE_32HZ)) {
+            period_flag = 0;
+        }
+    }
+    _DPS310_FILTER_TEST_check("FIFO samples dated at the pressure rate", ((status == DPS310_SUCCESS) && (number_of_popped_samples == DPS310_DRIVER_SAMPLE_BUFFER_SIZE) && (period_flag != 0)));
+    status = DPS310_get_overrun_counts(handle, &sample_buffer_overrun_count, &fifo_overrun_count);
+    printf("%-52s buffer %u, FIFO %u\n", "  overruns", (unsigned int) sample_buffer_overrun_count, (unsigned int) fifo_overrun_count);
+    _DPS310_FILTER_TEST_check("samples dropped when the buffer is full", ((status == DPS310_SUCCESS) && (sample_buffer_overrun_count != 0)));
+}
+
+/*** DPS310 FILTER TEST main function ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    // Build description.
+    printf("DPS310 filter and samples buffer test (samples buffer of %u entries)\n\n", (unsigned int) DPS310_DRIVER_SAMPLE_BUFFER_SIZE);
+    status = DPS310_init();
+    _DPS310_FILTER_TEST_check("DPS310_init()", (status == DPS310_SUCCESS));
+    status = DPS310_init_handle(&dps310_filter_test_handle, 0, DPS310_FILTER_TEST_SENSOR_ADDRESS);
+    _DPS310_FILTER_TEST_check("DPS310_init_handle()", (status == DPS310_SUCCESS));
+    // Filter stages.
+    _DPS310_FILTER_TEST_step_response();
+    _DPS310_FILTER_TEST_spike_rejection(3, 1);
+    _DPS310_FILTER_TEST_spike_rejection(5, 2);
+    _DPS310_FILTER_TEST_kalman_convergence();
+    _DPS310_FILTER_TEST_fifo();
+    // Samples buffer on the simulated sensor.
+    _DPS310_FILTER_TEST_sample_buffer();
+    status = DPS310_de_init();
+    _DPS310_FILTER_TEST_check("DPS310_de_init()", (status == DPS310_SUCCESS));
+    return ((dps310_filter_test_failure_count == 0) ? 0 : 1);
+}
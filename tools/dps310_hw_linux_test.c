@@ -0,0 +1,248 @@
+/*
+ * dps310_hw_linux_test.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+#include <stdio.h>
+
+#include "dps310.h"
+#include "dps310_hw.h"
+#include "dps310_hw_linux.h"
+#include "types.h"
+
+/*** DPS310 HW LINUX TEST local macros ***/
+
+#ifndef DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES
+#define DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES  8
+#endif
+
+#define DPS310_HW_LINUX_TEST_I2C_INSTANCE       1
+#define DPS310_HW_LINUX_TEST_I2C_ADDRESS        0x77
+#define DPS310_HW_LINUX_TEST_FD                 42
+
+#define DPS310_HW_LINUX_TEST_NUMBER_OF_REGISTERS    0x40
+
+#define DPS310_HW_LINUX_TEST_REGISTER_MEAS_CFG      0x08
+#define DPS310_HW_LINUX_TEST_REGISTER_PRODUCT_ID    0x0D
+#define DPS310_HW_LINUX_TEST_REGISTER_COEF_C0B      0x10
+#define DPS310_HW_LINUX_TEST_REGISTER_COEF_SRCE     0x28
+
+// Coefficients and sensor ready, results always available.
+#define DPS310_HW_LINUX_TEST_MEAS_CFG_READY         0xF0
+
+// Pressure ready flag never set.
+#define DPS310_HW_LINUX_TEST_MEAS_CFG_PRESSURE_STUCK    0xE0
+// Non-blocking timeout of the pressure flag with 1 time oversampling (twice the 4 ms conversion time plus 10 ms).
+#define DPS310_HW_LINUX_TEST_PROCESS_TIMEOUT_US         18000
+
+// Number of bus transactions of a measurement once the sensor is configured.
+#define DPS310_HW_LINUX_TEST_MEASUREMENT_IOCTL_COUNT    5
+
+/*** DPS310 HW LINUX TEST local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    uint8_t registers[DPS310_HW_LINUX_TEST_NUMBER_OF_REGISTERS];
+    uint8_t register_pointer;
+    uint8_t ioctl_error_flag;
+    uint32_t open_count;
+    uint32_t close_count;
+    uint32_t protocol_error_count;
+} DPS310_HW_LINUX_TEST_device_t;
+
+/*** DPS310 HW LINUX TEST local global variables ***/
+
+static DPS310_HW_LINUX_TEST_device_t dps310_hw_linux_test_device;
+static uint32_t dps310_hw_linux_test_failure_count = 0;
+
+/*** DPS310 HW LINUX TEST system calls stand-ins ***/
+
+/*******************************************************************/
+int DPS310_HW_LINUX_open(uint8_t i2c_instance) {
+    // Only one bus is connected.
+    if (i2c_instance != DPS310_HW_LINUX_TEST_I2C_INSTANCE) return -1;
+    dps310_hw_linux_test_device.open_count++;
+    return DPS310_HW_LINUX_TEST_FD;
+}
+
+/*******************************************************************/
+int DPS310_HW_LINUX_close(int fd) {
+    // Check descriptor.
+    if (fd != DPS310_HW_LINUX_TEST_FD) return -1;
+    dps310_hw_linux_test_device.close_count++;
+    return 0;
+}
+
+/*******************************************************************/
+int DPS310_HW_LINUX_ioctl(int fd, unsigned long request, void* argument) {
+    // Local variables.
+    DPS310_HW_LINUX_TEST_device_t* device = &dps310_hw_linux_test_device;
+    struct i2c_rdwr_ioctl_data* transaction = (struct i2c_rdwr_ioctl_data*) argument;
+    struct i2c_msg* message = NULL;
+    uint32_t message_idx = 0;
+    uint16_t byte_idx = 0;
+    uint8_t address = 0;
+    // Only combined transfers are used by the backend.
+    if ((fd != DPS310_HW_LINUX_TEST_FD) || (request != I2C_RDWR) || (device->ioctl_error_flag != 0)) return -1;
+    for (message_idx = 0; message_idx < transaction->nmsgs; message_idx++) {
+        message = &(transaction->msgs[message_idx]);
+        // No acknowledge from other addresses.
+        if (message->addr != DPS310_HW_LINUX_TEST_I2C_ADDRESS) return -1;
+        if ((message->flags & I2C_M_RD) != 0) {
+            // A read must follow the register address write in the same transaction (repeated start).
+            if (message_idx == 0) {
+                device->protocol_error_count++;
+            }
+            for (byte_idx = 0; byte_idx < message->len; byte_idx++) {
+                message->buf[byte_idx] = device->registers[(device->register_pointer++) % DPS310_HW_LINUX_TEST_NUMBER_OF_REGISTERS];
+            }
+        }
+        else {
+            // First byte is the register address, next ones are written with auto-increment.
+            if (message->len == 0) return -1;
+            device->register_pointer = message->buf[0];
+            for (byte_idx = 1; byte_idx < message->len; byte_idx++) {
+                address = (uint8_t) ((device->register_pointer++) % DPS310_HW_LINUX_TEST_NUMBER_OF_REGISTERS);
+                // Status bits of MEAS_CFG are read-only.
+                if (address == DPS310_HW_LINUX_TEST_REGISTER_MEAS_CFG) {
+                    device->registers[address] = (uint8_t) ((device->registers[address] & 0xF0) | (message->buf[byte_idx] & 0x07));
+                }
+                else {
+                    device->registers[address] = message->buf[byte_idx];
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/*** DPS310 HW LINUX TEST local functions ***/
+
+/*******************************************************************/
+static void _DPS310_HW_LINUX_TEST_reset_device(void) {
+    // Local variables.
+    DPS310_HW_LINUX_TEST_device_t* device = &dps310_hw_linux_test_device;
+    uint8_t idx = 0;
+    // Power-on state with fixed results (pressure then temperature, 24-bits big endian).
+    for (idx = 0; idx < DPS310_HW_LINUX_TEST_NUMBER_OF_REGISTERS; idx++) {
+        device->registers[idx] = 0;
+    }
+    device->registers[0x00] = 0xF0;
+    device->registers[0x01] = 0x12;
+    device->registers[0x02] = 0x34;
+    device->registers[0x03] = 0x05;
+    device->registers[0x04] = 0x67;
+    device->registers[0x05] = 0x89;
+    device->registers[DPS310_HW_LINUX_TEST_REGISTER_MEAS_CFG] = DPS310_HW_LINUX_TEST_MEAS_CFG_READY;
+    device->registers[DPS310_HW_LINUX_TEST_REGISTER_PRODUCT_ID] = 0x10;
+    for (idx = 0; idx < 18; idx++) {
+        device->registers[DPS310_HW_LINUX_TEST_REGISTER_COEF_C0B + idx] = (uint8_t) ((idx * 37) + 11);
+    }
+    device->registers[DPS310_HW_LINUX_TEST_REGISTER_COEF_SRCE] = 0x80;
+    device->register_pointer = 0;
+    device->ioctl_error_flag = 0;
+    device->open_count = 0;
+    device->close_count = 0;
+    device->protocol_error_count = 0;
+}
+
+/*******************************************************************/
+static void _DPS310_HW_LINUX_TEST_check(const char* test, uint8_t condition) {
+    // Print result.
+    printf("%-52s %s\n", test, (condition != 0) ? "ok" : "FAILED");
+    if (condition == 0) {
+        dps310_hw_linux_test_failure_count++;
+    }
+}
+
+/*** DPS310 HW LINUX TEST main function ***/
+
+/*******************************************************************/
+int main(void) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_handle_t handle;
+    DPS310_configuration_t configuration;
+    DPS310_coefficients_t coefficients;
+    DPS310_HW_LINUX_statistics_t statistics;
+    int32_t pressure = 0;
+    int32_t temperature = 0;
+    int32_t prs_raw = 0;
+    int32_t tmp_raw = 0;
+    int32_t expected_pressure = 0;
+    int32_t expected_temperature = 0;
+    uint32_t start_us = 0;
+    uint32_t end_us = 0;
+    uint32_t process_count = 0;
+    // Fake i2c-dev device.
+    _DPS310_HW_LINUX_TEST_reset_device();
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.pressure_oversampling = DPS310_OVERSAMPLING_1;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.temperature_oversampling = DPS310_OVERSAMPLING_1;
+    configuration.pressure_unit = DPS310_PRESSURE_UNIT_PA_Q6;
+    configuration.temperature_unit = DPS310_TEMPERATURE_UNIT_CENTI_DEGREES;
+    configuration.temperature_period = 0;
+    printf("DPS310 Linux backend test (fake i2c-dev register model)\n\n");
+    // Sensor initialization.
+    status = DPS310_init();
+    _DPS310_HW_LINUX_TEST_check("DPS310_init()", (status == DPS310_SUCCESS));
+    status = DPS310_init_sensor(&handle, DPS310_HW_LINUX_TEST_I2C_INSTANCE, DPS310_HW_LINUX_TEST_I2C_ADDRESS, &configuration);
+    _DPS310_HW_LINUX_TEST_check("DPS310_init_sensor()", (status == DPS310_SUCCESS));
+    _DPS310_HW_LINUX_TEST_check("bus opened once", (dps310_hw_linux_test_device.open_count == 1));
+    // Measurement results must match the offline compensation of the raw registers.
+    status = DPS310_get_pressure_temperature(&handle, &pressure, &temperature);
+    _DPS310_HW_LINUX_TEST_check("DPS310_get_pressure_temperature()", (status == DPS310_SUCCESS));
+    DPS310_get_raw_results(&handle, &prs_raw, &tmp_raw);
+    DPS310_get_coefficients(&handle, &coefficients);
+    DPS310_compensate(&coefficients, &configuration, &prs_raw, &tmp_raw, &expected_pressure, &expected_temperature, 1);
+    _DPS310_HW_LINUX_TEST_check("raw results decoded from the registers", ((prs_raw == (int32_t) 0xFFF01234) && (tmp_raw == 0x056789)));
+    _DPS310_HW_LINUX_TEST_check("results match DPS310_compensate()", ((pressure == expected_pressure) && (temperature == expected_temperature)));
+    // Steady state bus usage.
+    DPS310_HW_LINUX_reset_statistics();
+    status = DPS310_get_pressure_temperature(&handle, &pressure, &temperature);
+    DPS310_HW_LINUX_get_statistics(&statistics);
+    printf("%-52s open %u ioctl %u messages %u bytes %u sleeps %u\n", "  measurement bus usage", (unsigned int) statistics.open_count, (unsigned int) statistics.ioctl_count, (unsigned int) statistics.i2c_message_count, (unsigned int) statistics.i2c_byte_count, (unsigned int) statistics.sleep_count);
+    _DPS310_HW_LINUX_TEST_check("one ioctl per bus transaction", ((status == DPS310_SUCCESS) && (statistics.open_count == 0) && (statistics.ioctl_count == DPS310_HW_LINUX_TEST_MEASUREMENT_IOCTL_COUNT)));
+    _DPS310_HW_LINUX_TEST_check("register reads use a repeated start", (dps310_hw_linux_test_device.protocol_error_count == 0));
+#ifndef DPS310_DRIVER_DISABLE_INTERRUPT
+    // No interrupt line through i2c-dev: the handle must stay in polling mode without any disable call.
+    status = DPS310_enable_interrupt(&handle, DPS310_INTERRUPT_PRESSURE, NULL);
+    _DPS310_HW_LINUX_TEST_check("DPS310_enable_interrupt() not supported", (status == DPS310_ERROR_INTERRUPT));
+    status = DPS310_get_pressure_temperature(&handle, &pressure, &temperature);
+    _DPS310_HW_LINUX_TEST_check("polled measurement after interrupt refusal", (status == DPS310_SUCCESS));
+#endif
+    // Non-blocking timeout is a duration, whatever the number of calls.
+    dps310_hw_linux_test_device.registers[DPS310_HW_LINUX_TEST_REGISTER_MEAS_CFG] = DPS310_HW_LINUX_TEST_MEAS_CFG_PRESSURE_STUCK;
+    DPS310_HW_get_timestamp_us(&start_us);
+    status = DPS310_start_measurement(&handle, NULL);
+    while (status == DPS310_SUCCESS) {
+        status = DPS310_process(&handle);
+        process_count++;
+    }
+    DPS310_HW_get_timestamp_us(&end_us);
+    printf("%-52s %u calls, %u us\n", "  process timeout", (unsigned int) process_count, (unsigned int) (end_us - start_us));
+    _DPS310_HW_LINUX_TEST_check("process timeout after the conversion timeout", ((status == DPS310_ERROR_PRESSURE_TIMEOUT) && ((end_us - start_us) >= DPS310_HW_LINUX_TEST_PROCESS_TIMEOUT_US)));
+    dps310_hw_linux_test_device.registers[DPS310_HW_LINUX_TEST_REGISTER_MEAS_CFG] = DPS310_HW_LINUX_TEST_MEAS_CFG_READY;
+    status = DPS310_get_pressure_temperature(&handle, &pressure, &temperature);
+    _DPS310_HW_LINUX_TEST_check("recovery after process timeout", (status == DPS310_SUCCESS));
+    // Bus errors.
+    dps310_hw_linux_test_device.ioctl_error_flag = 1;
+    status = DPS310_get_pressure_temperature(&handle, &pressure, &temperature);
+    _DPS310_HW_LINUX_TEST_check("ioctl failure reported as I2C error", (status == DPS310_ERROR_BASE_I2C));
+    dps310_hw_linux_test_device.ioctl_error_flag = 0;
+    status = DPS310_get_pressure_temperature(&handle, &pressure, &temperature);
+    _DPS310_HW_LINUX_TEST_check("recovery after ioctl failure", (status == DPS310_SUCCESS));
+    status = DPS310_init_sensor(&handle, (DPS310_HW_LINUX_TEST_I2C_INSTANCE + 1), DPS310_HW_LINUX_TEST_I2C_ADDRESS, &configuration);
+    _DPS310_HW_LINUX_TEST_check("open failure reported as I2C error", (status == DPS310_ERROR_BASE_I2C));
+    status = DPS310_init_sensor(&handle, DPS310_DRIVER_HW_LINUX_NUMBER_OF_BUSES, DPS310_HW_LINUX_TEST_I2C_ADDRESS, &configuration);
+    _DPS310_HW_LINUX_TEST_check("bus instance out of range", (status == DPS310_ERROR_BASE_I2C));
+    // Release.
+    status = DPS310_de_init();
+    _DPS310_HW_LINUX_TEST_check("DPS310_de_init() closes the bus once", ((status == DPS310_SUCCESS) && (dps310_hw_linux_test_device.close_count == 1)));
+    return ((dps310_hw_linux_test_failure_count == 0) ? 0 : 1);
+}
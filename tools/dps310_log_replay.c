@@ -0,0 +1,237 @@
+/*
+ * dps310_log_replay.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+// Required for clock_gettime() and mmap() with strict C dialects.
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dps310.h"
+#include "dps310_log.h"
+#include "types.h"
+
+/*** DPS310 LOG REPLAY local macros ***/
+
+#define DPS310_LOG_REPLAY_BLOCK_SIZE            4096
+
+// Maximum size given to a single decoder call (a record split at the end is decoded by the next call).
+#define DPS310_LOG_REPLAY_WINDOW_SIZE_BYTES     0x40000000
+
+// Generated logs: 128 Hz pressure with a new temperature every 16 samples.
+#define DPS310_LOG_REPLAY_GENERATOR_PERIOD_US   7812
+#define DPS310_LOG_REPLAY_GENERATOR_TMP_PERIOD  16
+#define DPS310_LOG_REPLAY_GENERATOR_BUFFER_SIZE (DPS310_LOG_HEADER_SIZE_BYTES + (DPS310_LOG_REPLAY_BLOCK_SIZE * 2 * DPS310_LOG_RECORD_SIZE_MAX))
+
+/*** DPS310 LOG REPLAY local global variables ***/
+
+// Typical sensor coefficients of the generated logs.
+static const DPS310_coefficients_t DPS310_LOG_REPLAY_GENERATOR_COEFFICIENTS = { 204, -261, 80469, -54769, -2400, 1191, -10185, 190, -1380 };
+
+static uint8_t dps310_log_replay_buffer[DPS310_LOG_REPLAY_GENERATOR_BUFFER_SIZE];
+static DPS310_sample_t dps310_log_replay_samples[DPS310_LOG_REPLAY_BLOCK_SIZE];
+static int32_t dps310_log_replay_prs_raw[DPS310_LOG_REPLAY_BLOCK_SIZE];
+static int32_t dps310_log_replay_tmp_raw[DPS310_LOG_REPLAY_BLOCK_SIZE];
+static int32_t dps310_log_replay_pressure[DPS310_LOG_REPLAY_BLOCK_SIZE];
+static int32_t dps310_log_replay_temperature[DPS310_LOG_REPLAY_BLOCK_SIZE];
+
+/*** DPS310 LOG REPLAY local functions ***/
+
+/*******************************************************************/
+static double _DPS310_LOG_REPLAY_get_time_s(void) {
+    // Local variables.
+    struct timespec now;
+    // Monotonic clock.
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double) now.tv_sec + ((double) now.tv_nsec * 1e-9));
+}
+
+/*******************************************************************/
+static uint64_t _DPS310_LOG_REPLAY_update_checksum(uint64_t checksum, uint32_t timestamp_us, int32_t pressure, int32_t temperature) {
+    // Order dependent checksum of all sample fields.
+    return ((checksum * 31) + (uint64_t) timestamp_us + (uint64_t) (uint32_t) pressure + ((uint64_t) (uint32_t) temperature << 32));
+}
+
+/*******************************************************************/
+static int _DPS310_LOG_REPLAY_generate(const char* file_path, uint32_t number_of_samples) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_LOG_encoder_t encoder;
+    DPS310_coefficients_t coefficients = DPS310_LOG_REPLAY_GENERATOR_COEFFICIENTS;
+    DPS310_configuration_t configuration;
+    FILE* file = NULL;
+    uint64_t checksum = 0;
+    uint32_t timestamp_us = 0;
+    uint32_t block_timestamp_us = 0;
+    uint32_t number_of_bytes = 0;
+    uint32_t sample_idx = 0;
+    uint32_t block_size = 0;
+    uint32_t idx = 0;
+    // Logged configuration.
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_128HZ;
+    configuration.pressure_oversampling = DPS310_OVERSAMPLING_8;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_8HZ;
+    configuration.temperature_oversampling = DPS310_OVERSAMPLING_1;
+    configuration.pressure_unit = DPS310_PRESSURE_UNIT_PA_Q6;
+    configuration.temperature_unit = DPS310_TEMPERATURE_UNIT_CENTI_DEGREES;
+    configuration.temperature_period = DPS310_LOG_REPLAY_GENERATOR_TMP_PERIOD;
+    file = fopen(file_path, "wb");
+    if (file == NULL) {
+        perror(file_path);
+        return 1;
+    }
+    DPS310_LOG_init_encoder(&encoder, dps310_log_replay_buffer, DPS310_LOG_REPLAY_GENERATOR_BUFFER_SIZE);
+    status = DPS310_LOG_write_header(&encoder, &coefficients, &configuration, timestamp_us);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Slowly varying pressure and temperature, written and checked by blocks.
+    for (sample_idx = 0; sample_idx < number_of_samples; sample_idx += block_size) {
+        block_size = (number_of_samples - sample_idx);
+        if (block_size > DPS310_LOG_REPLAY_BLOCK_SIZE) {
+            block_size = DPS310_LOG_REPLAY_BLOCK_SIZE;
+        }
+        block_timestamp_us = timestamp_us;
+        for (idx = 0; idx < block_size; idx++) {
+            timestamp_us += DPS310_LOG_REPLAY_GENERATOR_PERIOD_US;
+            dps310_log_replay_prs_raw[idx] = (int32_t) (-1048576 + (int32_t) ((sample_idx + idx) % 4099) * 61);
+            dps310_log_replay_tmp_raw[idx] = (int32_t) (150000 + (int32_t) (((sample_idx + idx) / DPS310_LOG_REPLAY_GENERATOR_TMP_PERIOD) % 997) * 13);
+            status = DPS310_LOG_write_measurement(&encoder, timestamp_us, dps310_log_replay_prs_raw[idx], dps310_log_replay_tmp_raw[idx]);
+            if (status != DPS310_SUCCESS) goto errors;
+        }
+        // Expected samples are compensated directly from the raw values.
+        status = DPS310_compensate(&coefficients, &configuration, dps310_log_replay_prs_raw, dps310_log_replay_tmp_raw, dps310_log_replay_pressure, dps310_log_replay_temperature, block_size);
+        if (status != DPS310_SUCCESS) goto errors;
+        for (idx = 0; idx < block_size; idx++) {
+            block_timestamp_us += DPS310_LOG_REPLAY_GENERATOR_PERIOD_US;
+            checksum = _DPS310_LOG_REPLAY_update_checksum(checksum, block_timestamp_us, dps310_log_replay_pressure[idx], dps310_log_replay_temperature[idx]);
+        }
+        DPS310_LOG_flush(&encoder, &number_of_bytes);
+        if (fwrite(dps310_log_replay_buffer, 1, number_of_bytes, file) != number_of_bytes) {
+            perror(file_path);
+            fclose(file);
+            return 1;
+        }
+    }
+errors:
+    fclose(file);
+    if (status != DPS310_SUCCESS) {
+        printf("log encoding error 0x%04x\n", (unsigned int) status);
+        return 1;
+    }
+    printf("generated %u samples, checksum %llu\n", (unsigned int) number_of_samples, (unsigned long long) checksum);
+    return 0;
+}
+
+/*******************************************************************/
+static int _DPS310_LOG_REPLAY_replay(const char* file_path, uint8_t print_flag) {
+    // Local variables.
+    DPS310_status_t status = DPS310_SUCCESS;
+    DPS310_LOG_decoder_t decoder;
+    struct stat file_status;
+    uint8_t* data = NULL;
+    int fd = 0;
+    size_t data_size_bytes = 0;
+    size_t data_idx = 0;
+    size_t window_size_bytes = 0;
+    uint64_t total_number_of_samples = 0;
+    uint64_t checksum = 0;
+    uint32_t number_of_samples = 0;
+    uint32_t number_of_bytes = 0;
+    uint32_t idx = 0;
+    double start_s = 0.0;
+    double elapsed_s = 0.0;
+    // Map the whole file (pages are loaded on demand by the kernel).
+    fd = open(file_path, O_RDONLY);
+    if (fd < 0) {
+        perror(file_path);
+        return 1;
+    }
+    if (fstat(fd, &file_status) != 0) {
+        perror(file_path);
+        close(fd);
+        return 1;
+    }
+    data_size_bytes = (size_t) file_status.st_size;
+    if (data_size_bytes < DPS310_LOG_HEADER_SIZE_BYTES) {
+        fprintf(stderr, "%s: too small for a log header\n", file_path);
+        close(fd);
+        return 1;
+    }
+    data = (uint8_t*) mmap(NULL, data_size_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        perror(file_path);
+        return 1;
+    }
+    posix_madvise(data, data_size_bytes, POSIX_MADV_SEQUENTIAL);
+    // Decode header.
+    DPS310_LOG_init_decoder(&decoder);
+    status = DPS310_LOG_read_header(&decoder, data, DPS310_LOG_HEADER_SIZE_BYTES);
+    if (status != DPS310_SUCCESS) goto errors;
+    data_idx = DPS310_LOG_HEADER_SIZE_BYTES;
+    // Replay by blocks directly from the mapping.
+    start_s = _DPS310_LOG_REPLAY_get_time_s();
+    while (data_idx < data_size_bytes) {
+        window_size_bytes = (data_size_bytes - data_idx);
+        if (window_size_bytes > DPS310_LOG_REPLAY_WINDOW_SIZE_BYTES) {
+            window_size_bytes = DPS310_LOG_REPLAY_WINDOW_SIZE_BYTES;
+        }
+        status = DPS310_LOG_replay(&decoder, &(data[data_idx]), (uint32_t) window_size_bytes, dps310_log_replay_samples, DPS310_LOG_REPLAY_BLOCK_SIZE, &number_of_samples, &number_of_bytes);
+        if (status != DPS310_SUCCESS) goto errors;
+        // Truncated last record.
+        if (number_of_bytes == 0) break;
+        data_idx += number_of_bytes;
+        total_number_of_samples += number_of_samples;
+        for (idx = 0; idx < number_of_samples; idx++) {
+            checksum = _DPS310_LOG_REPLAY_update_checksum(checksum, dps310_log_replay_samples[idx].timestamp_us, dps310_log_replay_samples[idx].pressure, dps310_log_replay_samples[idx].temperature);
+            if (print_flag != 0) {
+                printf("%u,%d,%d\n", (unsigned int) dps310_log_replay_samples[idx].timestamp_us, (int) dps310_log_replay_samples[idx].pressure, (int) dps310_log_replay_samples[idx].temperature);
+            }
+        }
+    }
+    elapsed_s = (_DPS310_LOG_REPLAY_get_time_s() - start_s);
+errors:
+    munmap(data, data_size_bytes);
+    if (status != DPS310_SUCCESS) {
+        fprintf(stderr, "%s: log decoding error 0x%04x at byte %llu\n", file_path, (unsigned int) status, (unsigned long long) data_idx);
+        return 1;
+    }
+    if (data_idx < data_size_bytes) {
+        fprintf(stderr, "%s: %llu trailing bytes (truncated record)\n", file_path, (unsigned long long) (data_size_bytes - data_idx));
+    }
+    fprintf(stderr, "replayed %llu samples, checksum %llu\n", (unsigned long long) total_number_of_samples, (unsigned long long) checksum);
+    if (elapsed_s > 0.0) {
+        fprintf(stderr, "%.3f s, %.1f Msamples/s, %.1f MB/s (%.2f bytes/sample)\n", elapsed_s, ((double) total_number_of_samples / elapsed_s * 1e-6), ((double) data_idx / elapsed_s * 1e-6), (total_number_of_samples != 0) ? ((double) data_idx / (double) total_number_of_samples) : 0.0);
+    }
+    return 0;
+}
+
+/*** DPS310 LOG REPLAY main function ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Parse command line.
+    if ((argc == 4) && (strcmp(argv[1], "-g") == 0)) {
+        return _DPS310_LOG_REPLAY_generate(argv[2], (uint32_t) strtoul(argv[3], NULL, 10));
+    }
+    if ((argc == 3) && (strcmp(argv[1], "-p") == 0)) {
+        return _DPS310_LOG_REPLAY_replay(argv[2], 1);
+    }
+    if (argc == 2) {
+        return _DPS310_LOG_REPLAY_replay(argv[1], 0);
+    }
+    printf("Usage: %s [-p] <log_file>      replay a log (-p prints timestamp_us,pressure,temperature lines)\n", argv[0]);
+    printf("       %s -g <log_file> <n>    generate a log of n samples\n", argv[0]);
+    return 2;
+}
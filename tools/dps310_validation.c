@@ -0,0 +1,202 @@
+/*
+ * dps310_validation.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "dps310.h"
+#include "types.h"
+
+/*** DPS310 VALIDATION local macros ***/
+
+#define DPS310_VALIDATION_RAW_MIN                   (-8388608)
+#define DPS310_VALIDATION_RAW_MAX                   8388607
+
+#define DPS310_VALIDATION_BLOCK_SIZE                4096
+
+// Outputs are 32-bits integers.
+#define DPS310_VALIDATION_OUTPUT_MAX                2147483647.0
+
+// Realistic pressure range of the error statistics (300 to 1200 hPa).
+#define DPS310_VALIDATION_PRESSURE_MIN_PA           30000.0
+#define DPS310_VALIDATION_PRESSURE_MAX_PA           120000.0
+
+// Maximum errors allowed in the realistic range (in LSB of the output unit).
+#define DPS310_VALIDATION_PRESSURE_ERROR_MAX_LSB            1.0
+#define DPS310_VALIDATION_PRESSURE_ERROR_EXTREME_MAX_LSB    3.0
+#define DPS310_VALIDATION_TEMPERATURE_ERROR_MAX_LSB         1.0
+
+/*** DPS310 VALIDATION local structures ***/
+
+/*******************************************************************/
+typedef struct {
+    const char* name;
+    DPS310_coefficients_t coefficients;
+    double pressure_error_max_lsb;
+} DPS310_VALIDATION_set_t;
+
+/*******************************************************************/
+typedef struct {
+    double pressure_error_max;
+    double pressure_error_realistic_max;
+    double temperature_error_max;
+    uint32_t overflow_count;
+} DPS310_VALIDATION_errors_t;
+
+/*** DPS310 VALIDATION local global variables ***/
+
+// Scale factors of the datasheet for each oversampling.
+static const double DPS310_VALIDATION_SCALE_FACTOR[DPS310_OVERSAMPLING_LAST] = { 524288.0, 1572864.0, 3670016.0, 7864320.0, 253952.0, 516096.0, 1040384.0, 2088960.0 };
+
+// Typical sensor coefficients and the extreme values of each coefficient width.
+// The mixed set combines opposite extreme signs no real sensor has (its realistic range errors reach about 100 LSB): it only checks the absence of overflow.
+static const DPS310_VALIDATION_set_t DPS310_VALIDATION_SETS[] = {
+    { "typical", { 204, -261, 80469, -54769, -2400, 1191, -10185, 190, -1380 }, DPS310_VALIDATION_PRESSURE_ERROR_MAX_LSB },
+    { "minimum", { -2048, -2048, -524288, -524288, -32768, -32768, -32768, -32768, -32768 }, DPS310_VALIDATION_PRESSURE_ERROR_EXTREME_MAX_LSB },
+    { "maximum", { 2047, 2047, 524287, 524287, 32767, 32767, 32767, 32767, 32767 }, DPS310_VALIDATION_PRESSURE_ERROR_EXTREME_MAX_LSB },
+    { "mixed", { 2047, -2048, -524288, 524287, -32768, 32767, -32768, 32767, -32768 }, 0.0 },
+};
+
+static int32_t dps310_validation_prs_raw[DPS310_VALIDATION_BLOCK_SIZE];
+static int32_t dps310_validation_tmp_raw[DPS310_VALIDATION_BLOCK_SIZE];
+static int32_t dps310_validation_pressure[DPS310_VALIDATION_BLOCK_SIZE];
+static int32_t dps310_validation_temperature[DPS310_VALIDATION_BLOCK_SIZE];
+static int32_t dps310_validation_pressure_pa[DPS310_VALIDATION_BLOCK_SIZE];
+static int32_t dps310_validation_temperature_degrees[DPS310_VALIDATION_BLOCK_SIZE];
+
+/*** DPS310 VALIDATION local functions ***/
+
+/*******************************************************************/
+static double _DPS310_VALIDATION_absolute(double x) {
+    // Avoid libm dependency.
+    return ((x < 0.0) ? (-x) : x);
+}
+
+/*******************************************************************/
+static void _DPS310_VALIDATION_update(DPS310_VALIDATION_errors_t* errors, double* error_max, double value, double reference) {
+    // Local variables.
+    double error = _DPS310_VALIDATION_absolute(value - reference);
+    // Results which can not be represented in the output unit are only counted.
+    if (_DPS310_VALIDATION_absolute(reference) >= DPS310_VALIDATION_OUTPUT_MAX) {
+        errors->overflow_count++;
+        return;
+    }
+    // Update maximum.
+    if (error > (*error_max)) {
+        (*error_max) = error;
+    }
+}
+
+/*******************************************************************/
+static int _DPS310_VALIDATION_check_block(const DPS310_coefficients_t* coefficients, DPS310_oversampling_t oversampling, uint32_t number_of_samples, DPS310_VALIDATION_errors_t* errors) {
+    // Local variables.
+    DPS310_coefficients_t coefficients_copy = (*coefficients);
+    DPS310_configuration_t configuration;
+    DPS310_status_t status = DPS310_SUCCESS;
+    double prs_scaled = 0.0;
+    double tmp_scaled = 0.0;
+    double pressure_reference = 0.0;
+    double temperature_reference = 0.0;
+    uint32_t idx = 0;
+    // Compensate block in both units.
+    configuration.pressure_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.pressure_oversampling = oversampling;
+    configuration.temperature_rate = DPS310_MEASUREMENT_RATE_1HZ;
+    configuration.temperature_oversampling = oversampling;
+    configuration.pressure_unit = DPS310_PRESSURE_UNIT_PA_Q6;
+    configuration.temperature_unit = DPS310_TEMPERATURE_UNIT_CENTI_DEGREES;
+    configuration.temperature_period = 0;
+    status = DPS310_compensate(&coefficients_copy, &configuration, dps310_validation_prs_raw, dps310_validation_tmp_raw, dps310_validation_pressure, dps310_validation_temperature, number_of_samples);
+    if (status != DPS310_SUCCESS) goto errors;
+    configuration.pressure_unit = DPS310_PRESSURE_UNIT_PA;
+    configuration.temperature_unit = DPS310_TEMPERATURE_UNIT_DEGREES;
+    status = DPS310_compensate(&coefficients_copy, &configuration, dps310_validation_prs_raw, dps310_validation_tmp_raw, dps310_validation_pressure_pa, dps310_validation_temperature_degrees, number_of_samples);
+    if (status != DPS310_SUCCESS) goto errors;
+    // Compare to the floating-point formula of the datasheet.
+    for (idx = 0; idx < number_of_samples; idx++) {
+        prs_scaled = ((double) dps310_validation_prs_raw[idx]) / DPS310_VALIDATION_SCALE_FACTOR[oversampling];
+        tmp_scaled = ((double) dps310_validation_tmp_raw[idx]) / DPS310_VALIDATION_SCALE_FACTOR[oversampling];
+        pressure_reference = coefficients->c00 + prs_scaled * (coefficients->c10 + prs_scaled * (coefficients->c20 + prs_scaled * coefficients->c30)) + tmp_scaled * coefficients->c01 + tmp_scaled * prs_scaled * (coefficients->c11 + prs_scaled * coefficients->c21);
+        temperature_reference = coefficients->c0 * 0.5 + coefficients->c1 * tmp_scaled;
+        // Errors in LSB of each output unit.
+        _DPS310_VALIDATION_update(errors, &(errors->pressure_error_max), (double) dps310_validation_pressure[idx], pressure_reference * 64.0);
+        _DPS310_VALIDATION_update(errors, &(errors->pressure_error_max), (double) dps310_validation_pressure_pa[idx], pressure_reference);
+        if ((pressure_reference >= DPS310_VALIDATION_PRESSURE_MIN_PA) && (pressure_reference <= DPS310_VALIDATION_PRESSURE_MAX_PA)) {
+            _DPS310_VALIDATION_update(errors, &(errors->pressure_error_realistic_max), (double) dps310_validation_pressure[idx], pressure_reference * 64.0);
+            _DPS310_VALIDATION_update(errors, &(errors->pressure_error_realistic_max), (double) dps310_validation_pressure_pa[idx], pressure_reference);
+        }
+        _DPS310_VALIDATION_update(errors, &(errors->temperature_error_max), (double) dps310_validation_temperature[idx], temperature_reference * 100.0);
+        _DPS310_VALIDATION_update(errors, &(errors->temperature_error_max), (double) dps310_validation_temperature_degrees[idx], temperature_reference);
+    }
+errors:
+    if (status != DPS310_SUCCESS) {
+        printf("DPS310_compensate() error 0x%04x\n", (unsigned int) status);
+    }
+    return ((status == DPS310_SUCCESS) ? 0 : 1);
+}
+
+/*** DPS310 VALIDATION main function ***/
+
+/*******************************************************************/
+int main(int argc, char* argv[]) {
+    // Local variables.
+    const DPS310_VALIDATION_set_t* set = NULL;
+    DPS310_VALIDATION_errors_t errors;
+    uint32_t failure_count = 0;
+    uint32_t number_of_samples = 0;
+    int32_t raw_step = 1;
+    int32_t prs_raw = 0;
+    uint8_t set_idx = 0;
+    uint8_t oversampling = 0;
+    // Optional raw value step (1 for the full range).
+    if (argc > 1) {
+        raw_step = (int32_t) atoi(argv[1]);
+        if (raw_step < 1) {
+            printf("Usage: %s [raw_step]\n", argv[0]);
+            return 2;
+        }
+    }
+    printf("DPS310 compensation validation against the floating-point formula (raw step %d)\n", (int) raw_step);
+    printf("errors in LSB of the output unit: pressure 1/64 Pa or 1 Pa, temperature 0.01 or 1 degree\n");
+    printf("overflows: results out of the 32-bits output range (excluded from the errors)\n\n");
+    printf("%-10s %12s %12s %12s %10s  %s\n", "set", "pressure", "300-1200hPa", "temperature", "overflows", "result");
+    // Sweep the raw range of all oversampling settings for each coefficient set.
+    for (set_idx = 0; set_idx < (sizeof(DPS310_VALIDATION_SETS) / sizeof(DPS310_VALIDATION_set_t)); set_idx++) {
+        set = &(DPS310_VALIDATION_SETS[set_idx]);
+        errors.pressure_error_max = 0.0;
+        errors.pressure_error_realistic_max = 0.0;
+        errors.temperature_error_max = 0.0;
+        errors.overflow_count = 0;
+        for (oversampling = 0; oversampling < DPS310_OVERSAMPLING_LAST; oversampling++) {
+            number_of_samples = 0;
+            for (prs_raw = DPS310_VALIDATION_RAW_MIN; prs_raw <= (DPS310_VALIDATION_RAW_MAX - raw_step + 1); prs_raw += raw_step) {
+                // Temperature also covers its whole range, with a different sequence.
+                dps310_validation_prs_raw[number_of_samples] = prs_raw;
+                dps310_validation_tmp_raw[number_of_samples] = ((prs_raw * 7) % (DPS310_VALIDATION_RAW_MAX + 1));
+                number_of_samples++;
+                if (number_of_samples >= DPS310_VALIDATION_BLOCK_SIZE) {
+                    failure_count += (uint32_t) _DPS310_VALIDATION_check_block(&(set->coefficients), (DPS310_oversampling_t) oversampling, number_of_samples, &errors);
+                    number_of_samples = 0;
+                }
+            }
+            // Include the last raw value.
+            dps310_validation_prs_raw[number_of_samples] = DPS310_VALIDATION_RAW_MAX;
+            dps310_validation_tmp_raw[number_of_samples] = DPS310_VALIDATION_RAW_MIN;
+            number_of_samples++;
+            failure_count += (uint32_t) _DPS310_VALIDATION_check_block(&(set->coefficients), (DPS310_oversampling_t) oversampling, number_of_samples, &errors);
+        }
+        // Accuracy requirement of the set (none for the mixed one).
+        if ((set->pressure_error_max_lsb > 0.0) && ((errors.pressure_error_realistic_max > set->pressure_error_max_lsb) || (errors.temperature_error_max > DPS310_VALIDATION_TEMPERATURE_ERROR_MAX_LSB))) {
+            failure_count++;
+            printf("%-10s %12.3f %12.3f %12.3f %10u  FAILED\n", set->name, errors.pressure_error_max, errors.pressure_error_realistic_max, errors.temperature_error_max, (unsigned int) errors.overflow_count);
+        }
+        else {
+            printf("%-10s %12.3f %12.3f %12.3f %10u  %s\n", set->name, errors.pressure_error_max, errors.pressure_error_realistic_max, errors.temperature_error_max, (unsigned int) errors.overflow_count, (set->pressure_error_max_lsb > 0.0) ? "ok" : "-");
+        }
+    }
+    return ((failure_count == 0) ? 0 : 1);
+}
@@ -0,0 +1,17 @@
+/*
+ * dps310_driver_flags.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __DPS310_DRIVER_FLAGS_H__
+#define __DPS310_DRIVER_FLAGS_H__
+
+/*** DPS310 driver compilation flags ***/
+
+// Host tools: no low level drivers, the other flags are given by the tools Makefile.
+#define DPS310_DRIVER_I2C_ERROR_BASE_LAST       0
+#define DPS310_DRIVER_DELAY_ERROR_BASE_LAST     0
+
+#endif /* __DPS310_DRIVER_FLAGS_H__ */
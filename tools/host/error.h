@@ -0,0 +1,13 @@
+/*
+ * error.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __ERROR_H__
+#define __ERROR_H__
+
+// Host replacement of the embedded-utils error header, used by the tools only.
+
+#endif /* __ERROR_H__ */
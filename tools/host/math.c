@@ -0,0 +1,36 @@
+/*
+ * math.c
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#include "math.h"
+
+#include "types.h"
+
+/*** MATH functions ***/
+
+/*******************************************************************/
+MATH_status_t MATH_two_complement_to_integer(uint32_t value, uint8_t sign_bit_position, int32_t* result) {
+    // Local variables.
+    MATH_status_t status = MATH_SUCCESS;
+    // Check parameters.
+    if (result == NULL) {
+        status = MATH_ERROR_NULL_PARAMETER;
+        goto errors;
+    }
+    if (sign_bit_position > 31) {
+        status = MATH_ERROR_SIGN_BIT;
+        goto errors;
+    }
+    // Extend sign bit.
+    if (((value >> sign_bit_position) & 0x01) != 0) {
+        (*result) = (int32_t) (value | (0xFFFFFFFF << sign_bit_position));
+    }
+    else {
+        (*result) = (int32_t) (value & ~(0xFFFFFFFF << sign_bit_position));
+    }
+errors:
+    return status;
+}
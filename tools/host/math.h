@@ -0,0 +1,42 @@
+/*
+ * math.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __MATH_H__
+#define __MATH_H__
+
+// Host replacement of the embedded-utils math functions used by the driver (tools only).
+#include "types.h"
+
+/*** MATH structures ***/
+
+/*!******************************************************************
+ * \enum MATH_status_t
+ * \brief MATH functions execution status.
+ *******************************************************************/
+typedef enum {
+    MATH_SUCCESS = 0,
+    MATH_ERROR_NULL_PARAMETER,
+    MATH_ERROR_SIGN_BIT,
+    MATH_ERROR_BASE_LAST = 0x0100
+} MATH_status_t;
+
+/*** MATH functions ***/
+
+/*!******************************************************************
+ * \fn MATH_status_t MATH_two_complement_to_integer(uint32_t value, uint8_t sign_bit_position, int32_t* result)
+ * \brief Convert a two complement value to the equivalent signed integer.
+ * \param[in]   value: Two complement value to convert.
+ * \param[in]   sign_bit_position: Position of the sign bit.
+ * \param[out]  result: Pointer to the signed result.
+ * \retval      Function execution status.
+ *******************************************************************/
+MATH_status_t MATH_two_complement_to_integer(uint32_t value, uint8_t sign_bit_position, int32_t* result);
+
+/*******************************************************************/
+#define MATH_exit_error(base) { if (math_status != MATH_SUCCESS) { status = (base + math_status); goto errors; } }
+
+#endif /* __MATH_H__ */
@@ -0,0 +1,17 @@
+/*
+ * types.h
+ *
+ *  Created on: 30 aug. 2024
+ *      Author: Ludo
+ */
+
+#ifndef __TYPES_H__
+#define __TYPES_H__
+
+// Host replacement of the MCU types header, used by the tools only.
+#include <stddef.h>
+#include <stdint.h>
+
+#define UNUSED(x)   ((void) (x))
+
+#endif /* __TYPES_H__ */